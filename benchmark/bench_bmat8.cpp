@@ -17,6 +17,7 @@
 //  with HP-Combi. If not, see <https://www.gnu.org/licenses/>.               //
 //****************************************************************************//
 
+#include <cstdint>
 #include <cstdlib>
 #include <iostream>
 #include <string>
@@ -28,6 +29,7 @@
 #include "bench_main.hpp"
 
 #include "hpcombi/bmat8.hpp"
+#include "hpcombi/bmat8_orbits.hpp"
 
 namespace HPCombi {
 
@@ -109,4 +111,165 @@ TEST_CASE_METHOD(Fix_BMat8, "Pair row space inclusion", "[BMat8][004]") {
     };
 }
 
+// The former detail::row_space_update_bitset, whose tables were function
+// local statics tested by a thread safe guard on each call
+__attribute__((noinline)) void
+row_space_update_bitset_guarded(epu8 block, epu8 &set0, epu8 &set1) noexcept {
+    static const epu8 shiftres_guarded{1, 2, 4, 8, 0x10, 0x20, 0x40, 0x80};
+    static const epu8 bound08 = simde_mm_slli_epi32(
+        static_cast<simde__m128i>(Epu8.id()), 3);  // shift for *8
+    static const epu8 bound18 = bound08 + Epu8(0x80);
+    for (size_t slice8 = 0; slice8 < 16; slice8++) {
+        epu8 bm5 = Epu8(0xf8) & block; /* 11111000 */
+        epu8 shft = simde_mm_shuffle_epi8(shiftres_guarded, block - bm5);
+        set0 |= (bm5 == bound08) & shft;
+        set1 |= (bm5 == bound18) & shft;
+        block = simde_mm_shuffle_epi8(block, Epu8.right_cycle());
+    }
+}
+
+__attribute__((noinline)) void
+row_space_update_bitset_constexpr(epu8 block, epu8 &set0, epu8 &set1) noexcept {
+    detail::row_space_update_bitset(block, set0, set1);
+}
+
+TEST_CASE_METHOD(Fix_BMat8, "Row space bitset update", "[BMat8][005]") {
+    std::vector<epu8> blocks;
+    for (auto m : sample)
+        blocks.push_back(simde_mm_set_epi64x(m.to_int(), ~m.to_int()));
+    BENCHMARK("function local static tables") {
+        epu8 set0{}, set1{};
+        for (auto block : blocks)
+            row_space_update_bitset_guarded(block, set0, set1);
+        return set0 | set1;
+    };
+    BENCHMARK("constexpr tables") {
+        epu8 set0{}, set1{};
+        for (auto block : blocks)
+            row_space_update_bitset_constexpr(block, set0, set1);
+        return set0 | set1;
+    };
+}
+
+TEST_CASE_METHOD(Fix_BMat8, "Row space inclusion in many matrices",
+                 "[BMat8][006]") {
+    std::vector<uint64_t> out((sample.size() + 63) / 64);
+    BMat8 x = sample[0];
+    BENCHMARK("loop on row_space_included") {
+        std::fill(out.begin(), out.end(), 0);
+        for (size_t j = 0; j < sample.size(); j++)
+            out[j / 64] |= uint64_t(x.row_space_included(sample[j]))
+                           << (j % 64);
+        return out[0];
+    };
+    BENCHMARK("loop on row_space_included2") {
+        std::fill(out.begin(), out.end(), 0);
+        for (size_t j = 0; j < sample.size(); j += 2) {
+            auto res = BMat8::row_space_included2(x, sample[j], x,
+                                                  sample[j + 1]);
+            out[j / 64] |= (uint64_t(res.first) | uint64_t(res.second) << 1)
+                           << (j % 64);
+        }
+        return out[0];
+    };
+    BENCHMARK("row_space_included_many one in many") {
+        BMat8::row_space_included_many(x, sample.data(), sample.size(),
+                                       out.data());
+        return out[0];
+    };
+    BENCHMARK("loop on row_space_included reversed") {
+        std::fill(out.begin(), out.end(), 0);
+        for (size_t j = 0; j < sample.size(); j++)
+            out[j / 64] |= uint64_t(sample[j].row_space_included(x))
+                           << (j % 64);
+        return out[0];
+    };
+    BENCHMARK("row_space_included_many many in one") {
+        BMat8::row_space_included_many(sample.data(), sample.size(), x,
+                                       out.data());
+        return out[0];
+    };
+}
+
+TEST_CASE_METHOD(Fix_BMat8, "Invariants", "[BMat8][007]") {
+    BENCHMARK("separate calls") {
+        uint64_t res = 0;
+        for (auto const &m : sample) {
+            BMat8 t = m.transpose();
+            res += m.row_space_size() + t.row_space_size();
+            res += m.nr_rows() + t.nr_rows();
+            epu8 pop = sorted8(popcount16(simde_mm_set_epi64x(0, m.to_int())));
+            pop |= sorted8(popcount16(simde_mm_set_epi64x(0, t.to_int())));
+            res += pop[0];
+            res += m.row_space_basis().to_int() ^ m.col_space_basis().to_int();
+        }
+        return res;
+    };
+    BENCHMARK("invariants") {
+        uint64_t res = 0;
+        for (auto const &m : sample) {
+            auto inv = m.invariants();
+            res += inv.row_space_size + inv.col_space_size;
+            res += inv.nr_rows + inv.nr_cols;
+            res += (inv.row_popcounts | inv.col_popcounts)[0];
+            res += inv.row_space_basis.to_int() ^ inv.col_space_basis.to_int();
+        }
+        return res;
+    };
+    BENCHMARK("row_space_size alone") {
+        uint64_t res = 0;
+        for (auto const &m : sample)
+            res += m.row_space_size();
+        return res;
+    };
+}
+
+TEST_CASE("Orbits up to row and column permutations", "[BMat8][008]") {
+    BMat8Orbits const orbits4(4), orbits5(5);
+    BENCHMARK("dim 4: sweep all matrices") {
+        uint64_t res = 0;
+        for (uint64_t i = 0; i < (1 << 16); ++i) {
+            uint64_t x = 0;
+            for (size_t r = 0; r < 4; ++r)
+                x |= ((i >> (4 * r)) & 0xF) << (60 - 8 * r);
+            res += orbits4.is_canonical(BMat8(x));
+        }
+        return res;
+    };
+    BENCHMARK("dim 4: orderly generation") { return orbits4.count(1); };
+    BENCHMARK("dim 5: orderly generation, 1 thread") {
+        return orbits5.count(1);
+    };
+    BENCHMARK("dim 5: orderly generation, all threads") {
+        return orbits5.count();
+    };
+}
+
+TEST_CASE_METHOD(Fix_BMat8, "Idempotents and regular elements",
+                 "[BMat8][009]") {
+    BENCHMARK("x * x == x") {
+        size_t res = 0;
+        for (auto const &m : sample)
+            res += (m * m == m);
+        return res;
+    };
+    BENCHMARK("is_idempotent") {
+        size_t res = 0;
+        for (auto const &m : sample)
+            res += m.is_idempotent();
+        return res;
+    };
+    BENCHMARK("is_idempotent_many") {
+        std::vector<uint64_t> out((sample.size() + 63) / 64);
+        BMat8::is_idempotent_many(sample.data(), sample.size(), out.data());
+        return out;
+    };
+    BENCHMARK("is_regular_element") {
+        size_t res = 0;
+        for (auto const &m : sample)
+            res += m.is_regular_element();
+        return res;
+    };
+}
+
 }  // namespace HPCombi
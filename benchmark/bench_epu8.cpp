@@ -269,4 +269,153 @@ TEST_CASE_METHOD(Fix_epu8, "is_permutation", "[Epu8][011]") {
     BENCHMARK_LAMBDA("| lambda", is_permutation, Fix_epu8::perms);
 }
 
+TEST_CASE("Sorting arrays of epu8", "[Epu8][012]") {
+    std::vector<epu8> sample = rand_epu8(1024);
+    for (size_t n : {2, 4, 16}) {
+        std::vector<epu8> blocks;
+        BENCHMARK("std::sort | " + std::to_string(16 * n) + " bytes") {
+            for (size_t i = 0; i + n <= sample.size(); i += n) {
+                blocks.assign(sample.begin() + i, sample.begin() + i + n);
+                auto first = reinterpret_cast<uint8_t *>(blocks.data());
+                std::sort(first, first + 16 * n);
+            }
+            return blocks[0];
+        };
+        BENCHMARK("sort_blocks | " + std::to_string(16 * n) + " bytes") {
+            for (size_t i = 0; i + n <= sample.size(); i += n) {
+                blocks.assign(sample.begin() + i, sample.begin() + i + n);
+                sort_blocks(blocks.data(), n);
+            }
+            return blocks[0];
+        };
+    }
+    BENCHMARK("sorted(epu8x2)") {
+        epu8 res = {};
+        for (size_t i = 0; i + 2 <= sample.size(); i += 2)
+            res ^= sorted(epu8x2{sample[i], sample[i + 1]})[0];
+        return res;
+    };
+}
+
+TEST_CASE_METHOD(Fix_epu8, "Sorting by keys", "[Epu8][013]") {
+    BENCHMARK("sort_by_key") {
+        epu8 res = {};
+        for (auto &pair : pairs) {
+            epu8 keys = pair.first, values = pair.second;
+            sort_by_key(keys, values);
+            res ^= values;
+        }
+        return res;
+    };
+    BENCHMARK("std::sort of pairs") {
+        epu8 res = {};
+        for (auto &pair : pairs) {
+            std::array<std::pair<uint8_t, uint8_t>, 16> arr;
+            for (size_t i = 0; i < 16; i++)
+                arr[i] = {pair.first[i], pair.second[i]};
+            std::sort(arr.begin(), arr.end(), [](auto x, auto y) {
+                return x.first < y.first;
+            });
+            for (size_t i = 0; i < 16; i++)
+                res[i] ^= arr[i].second;
+        }
+        return res;
+    };
+}
+
+TEST_CASE("Sorting with bounded values", "[Epu8][014]") {
+    std::vector<epu8> sample3, sample5, sample16;
+    for (size_t i = 0; i < 1000; i++) {
+        sample3.push_back(random_epu8(3));
+        sample5.push_back(random_epu8(5));
+        sample16.push_back(random_epu8(16));
+    }
+    BENCHMARK_LAMBDA("| bound 3", sorted, sample3);
+    BENCHMARK_LAMBDA("| bound 3", sorted_count<3>, sample3);
+    BENCHMARK_LAMBDA("| bound 5", sorted, sample5);
+    BENCHMARK_LAMBDA("| bound 5", sorted_count<5>, sample5);
+    BENCHMARK_LAMBDA("| bound 16", sorted, sample16);
+    BENCHMARK_LAMBDA("| bound 16", sorted_count<16>, sample16);
+    BENCHMARK_LAMBDA("| bound 16", sorted_bounded<16>, sample16);
+}
+
+TEST_CASE("Histogram of 100000 epu8", "[Epu8][015]") {
+    std::vector<epu8> sample;
+    for (size_t i = 0; i < 100000; i++)
+        sample.push_back(random_epu8(16));
+    BENCHMARK("eval16 loop") {
+        std::array<uint64_t, 16> res{};
+        for (auto x : sample) {
+            epu8 ev = eval16(x);
+            for (size_t j = 0; j < 16; j++)
+                res[j] += ev[j];
+        }
+        return res;
+    };
+    BENCHMARK("histogram") { return histogram(sample.data(), sample.size()); };
+}
+
+TEST_CASE("Random generation of 1000 epu8", "[Epu8][016]") {
+    BENCHMARK("std::uniform_int_distribution") {
+        static std::mt19937 gen(0);
+        std::uniform_int_distribution<int> dist(0, 9);
+        std::vector<epu8> res(1000);
+        for (auto &x : res)
+            for (size_t i = 0; i < 16; i++)
+                x[i] = dist(gen);
+        return res;
+    };
+    BENCHMARK("random_epu8") {
+        std::vector<epu8> res(1000);
+        for (auto &x : res)
+            x = random_epu8(10);
+        return res;
+    };
+}
+
+TEST_CASE("Lexicographic compare of 1000 pairs of 32 epu8", "[Epu8][017]") {
+    constexpr size_t len = 32;
+    std::vector<std::vector<epu8>> left, right;
+    for (size_t i = 0; i < 1000; i++) {
+        std::vector<epu8> u(len);
+        for (auto &x : u)
+            x = random_epu8(4);
+        std::vector<epu8> w = u;
+        size_t pos = len / 2 + random_stream().below(len / 2);
+        w[pos] = random_epu8(4);
+        left.push_back(u);
+        right.push_back(w);
+    }
+    std::vector<VectGeneric<16 * len>> vleft, vright;
+    for (size_t i = 0; i < 1000; i++) {
+        vleft.push_back(
+            reinterpret_cast<VectGeneric<16 * len> const &>(*left[i].data()));
+        vright.push_back(
+            reinterpret_cast<VectGeneric<16 * len> const &>(*right[i].data()));
+    }
+    BENCHMARK("loop on epu8 less") {
+        size_t res = 0;
+        for (size_t i = 0; i < 1000; i++) {
+            auto const &u = left[i], &w = right[i];
+            size_t j = 0;
+            while (j < len && equal(u[j], w[j]))
+                j++;
+            res += j < len && less(u[j], w[j]);
+        }
+        return res;
+    };
+    BENCHMARK("lex_compare") {
+        size_t res = 0;
+        for (size_t i = 0; i < 1000; i++)
+            res += lex_compare(left[i].data(), right[i].data(), len) < 0;
+        return res;
+    };
+    BENCHMARK("VectGeneric operator<") {
+        size_t res = 0;
+        for (size_t i = 0; i < 1000; i++)
+            res += vleft[i] < vright[i];
+        return res;
+    };
+}
+
 }  // namespace HPCombi
@@ -22,10 +22,28 @@
 #include <random>
 #include <vector>
 
+#include <catch2/catch_test_case_info.hpp>
+#include <catch2/reporters/catch_reporter_event_listener.hpp>
+#include <catch2/reporters/catch_reporter_registrars.hpp>
+
 #include "hpcombi/epu8.hpp"
+#include "hpcombi/random.hpp"
 
 using HPCombi::epu8;
 
+// Reseed the random stream of the thread running the benchmarks before each
+// test case and its fixture, so that the samples are the same from one run
+// to the other and do not depend on the test cases run before.
+struct RandomSeedListener : Catch::EventListenerBase {
+    using EventListenerBase::EventListenerBase;  // inherit constructor
+
+    void testCaseStarting(Catch::TestCaseInfo const &) override {
+        HPCombi::set_random_seed(0x5eed);
+    }
+};
+
+CATCH_REGISTER_LISTENER(RandomSeedListener)
+
 constexpr uint_fast64_t size = 10;
 // constexpr uint_fast64_t repeat = 100;
 
@@ -37,17 +55,14 @@ std::vector<epu8> rand_epu8(size_t sz) {
 }
 
 inline epu8 rand_perm() {
-    static std::random_device rd;
-    static std::mt19937 g(rd());
     epu8 res = HPCombi::Epu8.id();
     auto &ar = HPCombi::as_array(res);
-    std::shuffle(ar.begin(), ar.end(), g);
+    std::shuffle(ar.begin(), ar.end(), HPCombi::random_stream());
     return res;
 }
 
 std::vector<epu8> rand_perms(int sz) {
     std::vector<epu8> res(sz);
-    std::srand(std::time(0));
     for (int i = 0; i < sz; i++)
         res[i] = rand_perm();
     return res;
@@ -55,7 +70,6 @@ std::vector<epu8> rand_perms(int sz) {
 
 std::vector<epu8> rand_transf(int sz) {
     std::vector<epu8> res(sz);
-    std::srand(std::time(0));
     for (int i = 0; i < sz; i++)
         res[i] = HPCombi::random_epu8(15);
     return res;
@@ -0,0 +1,142 @@
+//****************************************************************************//
+//     Copyright (C) 2016-2024 Florent Hivert <Florent.Hivert@lisn.fr>,       //
+//                                                                            //
+//  This file is part of HP-Combi <https://github.com/libsemigroups/HPCombi>  //
+//                                                                            //
+//  HP-Combi is free software: you can redistribute it and/or modify it       //
+//  under the terms of the GNU General Public License as published by the     //
+//  Free Software Foundation, either version 3 of the License, or             //
+//  (at your option) any later version.                                       //
+//                                                                            //
+//  HP-Combi is distributed in the hope that it will be useful, but WITHOUT   //
+//  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or     //
+//  FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License      //
+//  for  more details.                                                        //
+//                                                                            //
+//  You should have received a copy of the GNU General Public License along   //
+//  with HP-Combi. If not, see <https://www.gnu.org/licenses/>.               //
+//****************************************************************************//
+
+#include <algorithm>      // for max
+#include <cstddef>        // for size_t
+#include <cstdint>        // for uint64_t
+#include <iomanip>        // for setw
+#include <iostream>       // for cout
+#include <string>         // for string
+#include <unordered_set>  // for unordered_set
+#include <vector>         // for vector
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "bench_fixture.hpp"
+#include "bench_main.hpp"
+
+#include "hpcombi/bmat8.hpp"
+#include "hpcombi/hash.hpp"
+#include "hpcombi/perm16.hpp"
+
+namespace HPCombi {
+
+namespace {
+
+constexpr size_t nb_keys = 100000;
+
+// Transformations of rank at most 3
+std::vector<Transf16> small_rank_transf() {
+    std::vector<Transf16> res;
+    for (size_t i = 0; i < nb_keys; i++)
+        res.push_back(Transf16(random_epu8(3)));
+    return res;
+}
+
+// Bucket statistics of a table with 2^k >= 2 * n buckets indexed by the low
+// bits of the hash, as in open addressing tables: number of distinct hash
+// values, max bucket load, and the number of keys landing in an already used
+// bucket, to be compared with the expected n^2 / (2 * nb_buckets) for an
+// ideal hash.
+void print_stats(std::string const &name, std::vector<uint64_t> const &h) {
+    size_t nb_buckets = 1;
+    while (nb_buckets < 2 * h.size())
+        nb_buckets *= 2;
+    std::vector<size_t> load(nb_buckets, 0);
+    size_t collisions = 0, max_load = 0;
+    for (auto x : h) {
+        size_t &l = load[x & (nb_buckets - 1)];
+        collisions += (l != 0);
+        max_load = std::max(max_load, ++l);
+    }
+    std::unordered_set<uint64_t> distinct(h.begin(), h.end());
+    std::cout << std::setw(36) << std::left << name
+              << " distinct: " << std::setw(7) << distinct.size()
+              << " max load: " << std::setw(5) << max_load
+              << " collisions: " << std::setw(7) << collisions
+              << " (ideal ~" << h.size() * (h.size() - 1) / (2 * nb_buckets)
+              << ")" << std::endl;
+}
+
+// The low 64 bits of a key
+uint64_t low_bits(uint64_t x) { return x; }
+uint64_t low_bits(epu8 x) { return simde_mm_extract_epi64(x, 0); }
+
+template <typename T, typename Hasher>
+std::vector<uint64_t> hashes(std::vector<T> const &keys) {
+    std::vector<uint64_t> res(keys.size());
+    hash_many<T, Hasher>(keys.data(), keys.size(), res.data());
+    return res;
+}
+
+template <typename T> void print_all_stats(std::string const &name,
+                                           std::vector<T> keys) {
+    // Duplicated keys would be counted as collisions
+    std::unordered_set<T> distinct(keys.begin(), keys.end());
+    keys.assign(distinct.begin(), distinct.end());
+    std::vector<uint64_t> id(keys.size());
+    for (size_t i = 0; i < keys.size(); i++)
+        id[i] = low_bits(hash_key(keys[i]));
+    print_stats(name + " | identity key", id);
+    print_stats(name + " | fast", hashes<T, FastHash<T>>(keys));
+    print_stats(name + " | strong", hashes<T, StrongHash<T>>(keys));
+}
+
+}  // namespace
+
+#define BENCHMARK_HASHES(T, keys)                                              \
+    BENCHMARK("std::hash loop") {                                              \
+        for (size_t i = 0; i < keys.size(); i++)                               \
+            out[i] = std::hash<T>()(keys[i]);                                  \
+        return out[0];                                                         \
+    };                                                                         \
+    BENCHMARK("hash_many fast") {                                              \
+        hash_many<T, FastHash<T>>(keys.data(), keys.size(), out.data());       \
+        return out[0];                                                         \
+    };                                                                         \
+    BENCHMARK("hash_many strong") {                                            \
+        hash_many<T, StrongHash<T>>(keys.data(), keys.size(), out.data());     \
+        return out[0];                                                         \
+    };
+
+TEST_CASE("Hashing Transf16 of small rank", "[Hash][000]") {
+    auto keys = small_rank_transf();
+    std::vector<uint64_t> out(keys.size());
+    print_all_stats("Transf16 rank <= 3", keys);
+    print_all_stats("PTransf16 rank <= 3",
+                    std::vector<PTransf16>(keys.begin(), keys.end()));
+    BENCHMARK_HASHES(Transf16, keys);
+}
+
+TEST_CASE("Hashing sparse BMat8", "[Hash][001]") {
+    auto keys = BMat8::random_many(nb_keys, 8, 0.05);
+    std::vector<uint64_t> out(keys.size());
+    print_all_stats("BMat8 density 0.05", keys);
+    BENCHMARK_HASHES(BMat8, keys);
+}
+
+TEST_CASE("Hashing Perm16", "[Hash][002]") {
+    auto keys = Perm16::random_many(nb_keys, 16);
+    std::vector<uint64_t> out(keys.size());
+    print_all_stats("Perm16", keys);
+    BENCHMARK_HASHES(Perm16, keys);
+}
+
+}  // namespace HPCombi
@@ -0,0 +1,112 @@
+//****************************************************************************//
+//     Copyright (C) 2016-2024 Florent Hivert <Florent.Hivert@lisn.fr>,       //
+//                                                                            //
+//  This file is part of HP-Combi <https://github.com/libsemigroups/HPCombi>  //
+//                                                                            //
+//  HP-Combi is free software: you can redistribute it and/or modify it       //
+//  under the terms of the GNU General Public License as published by the     //
+//  Free Software Foundation, either version 3 of the License, or             //
+//  (at your option) any later version.                                       //
+//                                                                            //
+//  HP-Combi is distributed in the hope that it will be useful, but WITHOUT   //
+//  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or     //
+//  FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License      //
+//  for  more details.                                                        //
+//                                                                            //
+//  You should have received a copy of the GNU General Public License along   //
+//  with HP-Combi. If not, see <https://www.gnu.org/licenses/>.               //
+//****************************************************************************//
+
+#include <algorithm>  // for sort, lower_bound
+#include <cstddef>    // for size_t
+#include <set>        // for set
+#include <vector>     // for vector
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "bench_fixture.hpp"
+#include "bench_main.hpp"
+
+#include "hpcombi/lex_index.hpp"
+#include "hpcombi/perm16.hpp"
+
+namespace HPCombi {
+
+namespace {
+
+bool lex_less(epu8 a, epu8 b) { return less(a, b); }
+
+std::vector<epu8> sorted_perms(size_t n) {
+    std::vector<epu8> res;
+    for (size_t i = 0; i < n; i++)
+        res.push_back(Perm16::random().v);
+    std::sort(res.begin(), res.end(), lex_less);
+    return res;
+}
+
+}  // namespace
+
+class Fix_LexIndex {
+ public:
+    explicit Fix_LexIndex(size_t n)
+        : keys(sorted_perms(n)), queries(sorted_perms(1000)),
+          set(keys.begin(), keys.end()), index(keys) {
+        // half of the queries are found
+        for (size_t i = 0; i < queries.size(); i += 2)
+            queries[i] = keys[(i * 7919) % keys.size()];
+    }
+    const std::vector<epu8> keys;
+    std::vector<epu8> queries;
+    const std::set<epu8, std::less<epu8>> set;
+    const LexIndex index;
+};
+
+#define BENCHMARK_LEX_INDEX(n)                                                 \
+    Fix_LexIndex fix(n);                                                       \
+    BENCHMARK("std::set find") {                                               \
+        size_t res = 0;                                                        \
+        for (auto x : fix.queries)                                             \
+            res += fix.set.find(x) != fix.set.end();                           \
+        return res;                                                            \
+    };                                                                         \
+    BENCHMARK("sorted vector lower_bound") {                                   \
+        size_t res = 0;                                                        \
+        for (auto x : fix.queries)                                             \
+            res += std::lower_bound(fix.keys.begin(), fix.keys.end(), x,       \
+                                    lex_less) -                                \
+                   fix.keys.begin();                                           \
+        return res;                                                            \
+    };                                                                         \
+    BENCHMARK("LexIndex lower_bound") {                                        \
+        size_t res = 0;                                                        \
+        for (auto x : fix.queries)                                             \
+            res += fix.index.lower_bound(x);                                   \
+        return res;                                                            \
+    };                                                                         \
+    BENCHMARK("LexIndex contains") {                                           \
+        size_t res = 0;                                                        \
+        for (auto x : fix.queries)                                             \
+            res += fix.index.contains(x);                                      \
+        return res;                                                            \
+    };                                                                         \
+    BENCHMARK("LexIndex prefix_count") {                                       \
+        size_t res = 0;                                                        \
+        for (auto x : fix.queries)                                             \
+            res += fix.index.prefix_count(x, 3);                               \
+        return res;                                                            \
+    };
+
+TEST_CASE("LexIndex on 1000 permutations", "[LexIndex][000]") {
+    BENCHMARK_LEX_INDEX(1000);
+}
+
+TEST_CASE("LexIndex on 100000 permutations", "[LexIndex][001]") {
+    BENCHMARK_LEX_INDEX(100000);
+}
+
+TEST_CASE("LexIndex on 4000000 permutations", "[LexIndex][002]") {
+    BENCHMARK_LEX_INDEX(4000000);
+}
+
+}  // namespace HPCombi
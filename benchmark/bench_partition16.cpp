@@ -0,0 +1,93 @@
+//****************************************************************************//
+//    Copyright (C) 2018-2024 Finn Smith <fls3@st-andrews.ac.uk>              //
+//    Copyright (C) 2018-2024 James Mitchell <jdm3@st-andrews.ac.uk>          //
+//    Copyright (C) 2018-2024 Florent Hivert <Florent.Hivert@lisn.fr>,        //
+//                                                                            //
+//  This file is part of HP-Combi <https://github.com/libsemigroups/HPCombi>  //
+//                                                                            //
+//  HP-Combi is free software: you can redistribute it and/or modify it       //
+//  under the terms of the GNU General Public License as published by the     //
+//  Free Software Foundation, either version 3 of the License, or             //
+//  (at your option) any later version.                                       //
+//                                                                            //
+//  HP-Combi is distributed in the hope that it will be useful, but WITHOUT   //
+//  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or     //
+//  FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License      //
+//  for  more details.                                                        //
+//                                                                            //
+//  You should have received a copy of the GNU General Public License along   //
+//  with HP-Combi. If not, see <https://www.gnu.org/licenses/>.               //
+//****************************************************************************//
+
+#include <algorithm>  // for min
+#include <cstddef>    // for size_t
+#include <cstdint>    // for uint8_t
+#include <vector>     // for vector
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "bench_fixture.hpp"
+#include "bench_main.hpp"
+
+#include "hpcombi/partition16.hpp"
+
+namespace HPCombi {
+
+// Recursive generation of the partitions of n with parts at most m
+void partitions_rec(size_t n, size_t m, size_t i, Partition16 &p,
+                    std::vector<Partition16> &res) {
+    if (n == 0) {
+        res.push_back(p);
+        return;
+    }
+    for (size_t a = std::min(n, m); a > 0; a--) {
+        p[i] = a;
+        partitions_rec(n - a, a, i + 1, p, res);
+    }
+    p[i] = 0;
+}
+
+Partition16 conjugate_ref(Partition16 const &p) {
+    Partition16 res{};
+    for (size_t i = 0; i < 16 && p[i] != 0; i++)
+        for (size_t j = 0; j < p[i]; j++)
+            res[j]++;
+    return res;
+}
+
+TEST_CASE("All the 231 partitions of 16", "[Partition16][000]") {
+    BENCHMARK("recursive") {
+        std::vector<Partition16> res;
+        Partition16 p{};
+        partitions_rec(16, 16, 0, p, res);
+        return res;
+    };
+    BENCHMARK("next_revlex") { return Partition16::all(16); };
+    BENCHMARK("next_lex") {
+        std::vector<Partition16> res;
+        Partition16 p = Partition16::last(16);
+        do {
+            res.push_back(p);
+        } while (p.next_lex());
+        return res;
+    };
+}
+
+TEST_CASE("Conjugate of all the partitions of 16", "[Partition16][001]") {
+    auto const all = Partition16::all(16);
+    BENCHMARK("conjugate_ref") {
+        Partition16 res{};
+        for (auto const &p : all)
+            res.v |= conjugate_ref(p).v;
+        return res;
+    };
+    BENCHMARK("conjugate") {
+        Partition16 res{};
+        for (auto const &p : all)
+            res.v |= p.conjugate().v;
+        return res;
+    };
+}
+
+}  // namespace HPCombi
@@ -0,0 +1,129 @@
+//****************************************************************************//
+//     Copyright (C) 2016-2024 Florent Hivert <Florent.Hivert@lisn.fr>,       //
+//                                                                            //
+//  This file is part of HP-Combi <https://github.com/libsemigroups/HPCombi>  //
+//                                                                            //
+//  HP-Combi is free software: you can redistribute it and/or modify it       //
+//  under the terms of the GNU General Public License as published by the     //
+//  Free Software Foundation, either version 3 of the License, or             //
+//  (at your option) any later version.                                       //
+//                                                                            //
+//  HP-Combi is distributed in the hope that it will be useful, but WITHOUT   //
+//  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or     //
+//  FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License      //
+//  for  more details.                                                        //
+//                                                                            //
+//  You should have received a copy of the GNU General Public License along   //
+//  with HP-Combi. If not, see <https://www.gnu.org/licenses/>.               //
+//****************************************************************************//
+
+#include <algorithm>  // for any_of, copy
+#include <cstddef>    // for size_t
+#include <cstdint>    // for uint8_t
+#include <utility>    // for pair
+#include <vector>     // for vector
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "bench_fixture.hpp"
+#include "bench_main.hpp"
+
+#include "hpcombi/pattern.hpp"
+#include "hpcombi/perm16.hpp"
+
+namespace HPCombi {
+
+// The brute force approach of examples/pattern.cpp
+class ExamplePattern {
+ public:
+    ExamplePattern(std::vector<std::vector<uint8_t>> const &patterns,
+                   size_t n) {
+        for (auto const &patt : patterns) {
+            size_t k = patt.size();
+            Perm16 p = Perm16::one();
+            std::copy(patt.begin(), patt.end(), p.begin());
+            // extract_pattern returns the inverse of the standardization
+            epu8 inv = p.inverse_ref().v & (Epu8.id() < Epu8(uint8_t(k)));
+            patts.push_back({k, inv});
+            if (std::any_of(subperm.begin(), subperm.end(),
+                            [k](auto const &sub) { return sub.first == k; }))
+                continue;
+            for (uint32_t s = 0; s < (1u << n); s++) {
+                if (size_t(__builtin_popcount(s)) == k) {
+                    epu8 res = Epu8({}, 0xFF);
+                    int c = 0;
+                    for (size_t i = 0; i < 16; i++)
+                        if ((s >> i) & 1)
+                            res[c++] = i;
+                    subperm.push_back({k, res});
+                }
+            }
+        }
+    }
+    bool contains(Perm16 perm) const {
+        for (auto [k, patt] : patts) {
+            epu8 cst = Epu8(uint8_t(k));
+            for (auto [ks, sub] : subperm) {
+                if (ks != k)
+                    continue;
+                epu8 res = permuted(perm.v, sub) | (Epu8.id() >= cst);
+                res = sort_perm(res) & (Epu8.id() < cst);
+                if (equal(res, patt))
+                    return true;
+            }
+        }
+        return false;
+    }
+
+ private:
+    std::vector<std::pair<size_t, epu8>> patts;
+    std::vector<std::pair<size_t, epu8>> subperm;
+};
+
+std::vector<Perm16> make_perms(size_t n, size_t sz) {
+    std::vector<Perm16> res{};
+    for (size_t i = 0; i < sz; i++)
+        res.push_back(Perm16::random(n));
+    return res;
+}
+
+class Fix_Pattern {
+ public:
+    Fix_Pattern()
+        : sample9(make_perms(9, 1000)), sample16(make_perms(16, 1000)),
+          patts4({{0, 2, 3, 1}, {1, 3, 0, 2}, {2, 0, 3, 1}}),
+          patts5({{4, 3, 2, 1, 0}, {0, 1, 2, 3, 4}, {2, 4, 0, 1, 3}}) {}
+    ~Fix_Pattern() {}
+    const std::vector<Perm16> sample9, sample16;
+    const std::vector<std::vector<uint8_t>> patts4, patts5;
+};
+
+#define BENCHMARK_PATTERN(name, mem_fn, sample)                                \
+    BENCHMARK(name) {                                                          \
+        for (auto p : sample) {                                                \
+            volatile bool dummy = mem_fn(p);                                   \
+        }                                                                      \
+        return true;                                                           \
+    };
+
+TEST_CASE_METHOD(Fix_Pattern, "Avoidance of 3 patterns of size 4 in S_9",
+                 "[PatternMatcher][000]") {
+    ExamplePattern example(patts4, 9);
+    PatternMatcher matcher(patts4, 9);
+    BENCHMARK_PATTERN("example", example.contains, sample9);
+    BENCHMARK_PATTERN("contains_ref", matcher.contains_ref, sample9);
+    BENCHMARK_PATTERN("contains", matcher.contains, sample9);
+    BENCHMARK("contains_many") { return matcher.contains_many(sample9); };
+}
+
+TEST_CASE_METHOD(Fix_Pattern, "Avoidance of 3 patterns of size 5 in S_16",
+                 "[PatternMatcher][001]") {
+    ExamplePattern example(patts5, 16);
+    PatternMatcher matcher(patts5, 16);
+    BENCHMARK_PATTERN("example", example.contains, sample16);
+    BENCHMARK_PATTERN("contains", matcher.contains, sample16);
+    BENCHMARK("contains_many") { return matcher.contains_many(sample16); };
+}
+
+}  // namespace HPCombi
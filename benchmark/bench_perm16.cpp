@@ -29,7 +29,9 @@
 #include "hpcombi/perm_generic.hpp"
 
 using HPCombi::epu8;
+using HPCombi::random_stream;
 using HPCombi::Perm16;
+using HPCombi::PPerm16;
 using HPCombi::PTransf16;
 using HPCombi::Transf16;
 using HPCombi::Vect16;
@@ -63,16 +65,41 @@ std::vector<Transf16> make_Transf16(size_t n) {
     return res;
 }
 
+std::vector<PPerm16> make_PPerm16(size_t n) {
+    std::vector<epu8> gens = rand_perms(n);
+    std::vector<PPerm16> res{};
+    std::transform(gens.cbegin(), gens.cend(), std::back_inserter(res),
+                   [](epu8 x) -> PPerm16 {
+                       return x | (HPCombi::random_epu8(4) == epu8{});
+                   });
+    return res;
+}
+
+std::vector<std::pair<PPerm16, PPerm16>> make_Pair_PPerm16(size_t n) {
+    std::vector<PPerm16> gens = make_PPerm16(n);
+    std::vector<std::pair<PPerm16, PPerm16>> res{};
+    for (auto g1 : gens)
+        for (auto g2 : gens) {
+            // Half of the pairs are comparable
+            res.push_back({g1, res.size() % 2 ? g2 : g1.restricted(0xA5A5)});
+        }
+    return res;
+}
+
 class Fix_Perm16 {
  public:
     Fix_Perm16()
         : sample_Perm16(make_Perm16(1000)),
           sample_Transf16(make_Transf16(1000)),
-          sample_pair_Perm16(make_Pair_Perm16(40)) {}
+          sample_PPerm16(make_PPerm16(1000)),
+          sample_pair_Perm16(make_Pair_Perm16(40)),
+          sample_pair_PPerm16(make_Pair_PPerm16(40)) {}
     ~Fix_Perm16() {}
     const std::vector<Perm16> sample_Perm16;
     const std::vector<Transf16> sample_Transf16;
+    const std::vector<PPerm16> sample_PPerm16;
     const std::vector<std::pair<Perm16, Perm16>> sample_pair_Perm16;
+    const std::vector<std::pair<PPerm16, PPerm16>> sample_pair_PPerm16;
 };
 
 TEST_CASE_METHOD(Fix_Perm16, "Inverse of 1000 Perm16", "[Perm16][000]") {
@@ -121,3 +148,199 @@ TEST_CASE_METHOD(Fix_Perm16, "Rank of 1000 PTransf16", "[PTransf16][006]") {
     BENCHMARK_MEM_FN(rank_cmpestrm, sample_Transf16);
     BENCHMARK_MEM_FN(rank, sample_Transf16);
 }
+
+TEST_CASE_METHOD(Fix_Perm16,
+                 "Right weak order comparison of 1600 pairs of Perm16",
+                 "[Perm16][007]") {
+    BENCHMARK_MEM_FN_PAIR(right_weak_leq_ref, sample_pair_Perm16);
+    BENCHMARK_MEM_FN_PAIR(right_weak_leq, sample_pair_Perm16);
+}
+
+TEST_CASE_METHOD(Fix_Perm16, "Bruhat order comparison of 1600 pairs of Perm16",
+                 "[Perm16][008]") {
+    BENCHMARK_MEM_FN_PAIR(bruhat_leq_ref, sample_pair_Perm16);
+    BENCHMARK_MEM_FN_PAIR(bruhat_leq, sample_pair_Perm16);
+}
+
+TEST_CASE_METHOD(Fix_Perm16, "Weak order meet and join of 1600 pairs of Perm16",
+                 "[Perm16][009]") {
+    BENCHMARK_MEM_FN_PAIR(left_weak_meet_ref, sample_pair_Perm16);
+    BENCHMARK_MEM_FN_PAIR(left_weak_meet, sample_pair_Perm16);
+    BENCHMARK_MEM_FN_PAIR(left_weak_join_ref, sample_pair_Perm16);
+    BENCHMARK_MEM_FN_PAIR(left_weak_join, sample_pair_Perm16);
+    BENCHMARK_MEM_FN_PAIR(right_weak_join, sample_pair_Perm16);
+}
+
+TEST_CASE_METHOD(Fix_Perm16, "Descents of 1000 Perm16", "[Perm16][010]") {
+    BENCHMARK_MEM_FN(descents_bitset_ref, sample_Perm16);
+    BENCHMARK_MEM_FN(descents_bitset, sample_Perm16);
+}
+
+TEST_CASE_METHOD(Fix_Perm16, "Reduced word of 1000 Perm16", "[Perm16][011]") {
+    BENCHMARK_MEM_FN(reduced_word_ref, sample_Perm16);
+    BENCHMARK_MEM_FN(reduced_word, sample_Perm16);
+}
+
+TEST_CASE_METHOD(Fix_Perm16,
+                 "Natural order comparison of 1600 pairs of PPerm16",
+                 "[PPerm16][012]") {
+    BENCHMARK_MEM_FN_PAIR(natural_leq_ref, sample_pair_PPerm16);
+    BENCHMARK_MEM_FN_PAIR(natural_leq, sample_pair_PPerm16);
+    BENCHMARK("natural_leq_many") {
+        return sample_PPerm16[0].natural_leq_many(sample_PPerm16);
+    };
+}
+
+TEST_CASE_METHOD(Fix_Perm16, "Meet of 1600 pairs of PPerm16",
+                 "[PPerm16][013]") {
+    BENCHMARK_MEM_FN_PAIR(meet_ref, sample_pair_PPerm16);
+    BENCHMARK_MEM_FN_PAIR(meet, sample_pair_PPerm16);
+    BENCHMARK("meet_many") {
+        return sample_PPerm16[0].meet_many(sample_PPerm16);
+    };
+}
+
+TEST_CASE_METHOD(Fix_Perm16, "Compatibility of 1600 pairs of PPerm16",
+                 "[PPerm16][014]") {
+    BENCHMARK_MEM_FN_PAIR(is_compatible_ref, sample_pair_PPerm16);
+    BENCHMARK_MEM_FN_PAIR(is_compatible, sample_pair_PPerm16);
+}
+
+TEST_CASE_METHOD(Fix_Perm16, "Restriction of 1000 PPerm16",
+                 "[PPerm16][015]") {
+    BENCHMARK("restricted_ref") {
+        for (auto &elem : sample_PPerm16) {
+            volatile auto dummy = elem.restricted_ref(0x1234);
+        }
+        return true;
+    };
+    BENCHMARK("restricted") {
+        for (auto &elem : sample_PPerm16) {
+            volatile auto dummy = elem.restricted(0x1234);
+        }
+        return true;
+    };
+    BENCHMARK("restricted_many") {
+        return PPerm16::restricted_many(sample_PPerm16, 0x1234);
+    };
+}
+
+TEST_CASE_METHOD(Fix_Perm16, "Product with domain and image of 1000 PPerm16",
+                 "[PPerm16][016]") {
+    BENCHMARK("mult image_bitset") {
+        PPerm16 prod = PPerm16::one();
+        uint32_t img = 0;
+        for (auto &elem : sample_PPerm16) {
+            prod = prod * elem;
+            img ^= prod.image_bitset();
+            prod = prod.domain_bitset() ? prod : PPerm16::one();
+        }
+        return img;
+    };
+    std::vector<PPerm16> inverses;
+    for (auto &elem : sample_PPerm16)
+        inverses.push_back(elem.inverse_ref());
+    BENCHMARK("mult_track") {
+        PPerm16 prod = PPerm16::one(), inv = PPerm16::one();
+        uint32_t dom, img, res = 0;
+        for (size_t i = 0; i < sample_PPerm16.size(); i++) {
+            prod = prod.mult_track(sample_PPerm16[i], inverses[i], inv, dom,
+                                   img);
+            res ^= img;
+            prod = dom ? prod : PPerm16::one();
+            inv = dom ? inv : PPerm16::one();
+        }
+        return res;
+    };
+}
+
+TEST_CASE_METHOD(Fix_Perm16, "Inverse of 1000 PPerm16", "[PPerm16][017]") {
+    BENCHMARK_MEM_FN(inverse_ref, sample_PPerm16);
+#ifdef SIMDE_X86_SSE4_2_NATIVE
+    BENCHMARK_MEM_FN(inverse_find, sample_PPerm16);
+#endif
+    BENCHMARK_MEM_FN(inverse_cycle, sample_PPerm16);
+    BENCHMARK_MEM_FN(inverse, sample_PPerm16);
+    BENCHMARK("inverse2") {
+        for (size_t i = 0; i + 1 < sample_PPerm16.size(); i += 2) {
+            PPerm16 a = sample_PPerm16[i], b = sample_PPerm16[i + 1];
+            PPerm16::inverse2(a, b);
+            volatile auto dummy = a;
+            volatile auto dummy2 = b;
+        }
+        return true;
+    };
+}
+
+TEST_CASE_METHOD(Fix_Perm16, "Conjugation and commutators of Perm16",
+                 "[Perm16][018]") {
+    BENCHMARK("conjugate naive") {
+        for (auto &pair : sample_pair_Perm16) {
+            volatile auto dummy =
+                pair.first.inverse_ref() * pair.second * pair.first;
+        }
+        return true;
+    };
+    BENCHMARK_FREE_FN_PAIR(conjugate, sample_pair_Perm16);
+    BENCHMARK("commutator naive") {
+        for (auto &pair : sample_pair_Perm16) {
+            volatile auto dummy = pair.first.inverse_ref() *
+                                  pair.second.inverse_ref() * pair.first *
+                                  pair.second;
+        }
+        return true;
+    };
+    BENCHMARK_FREE_FN_PAIR(commutator, sample_pair_Perm16);
+    BENCHMARK("conjugate loop") {
+        Perm16 g = sample_Perm16[0];
+        std::vector<Perm16> res;
+        for (auto x : sample_Perm16)
+            res.push_back(conjugate(g, x));
+        return res;
+    };
+    BENCHMARK("conjugate_all") {
+        return conjugate_all(sample_Perm16, sample_Perm16[0]);
+    };
+}
+
+TEST_CASE("Random generation of 1000 Perm16", "[Perm16][019]") {
+    BENCHMARK("std::shuffle with std::mt19937") {
+        static std::mt19937 gen(0);
+        std::vector<Perm16> res(1000, Perm16::one());
+        for (auto &p : res)
+            std::shuffle(p.as_array().begin(), p.as_array().end(), gen);
+        return res;
+    };
+    BENCHMARK("std::shuffle with random_stream") {
+        std::vector<Perm16> res(1000, Perm16::one());
+        for (auto &p : res)
+            std::shuffle(p.as_array().begin(), p.as_array().end(),
+                         random_stream());
+        return res;
+    };
+    BENCHMARK("random") {
+        std::vector<Perm16> res;
+        for (size_t i = 0; i < 1000; i++)
+            res.push_back(Perm16::random());
+        return res;
+    };
+    BENCHMARK("random_many") { return Perm16::random_many(1000); };
+}
+
+TEST_CASE_METHOD(Fix_Perm16, "Idempotents among 1000 Transf16",
+                 "[Transf16][020]") {
+    BENCHMARK("x * x == x") {
+        size_t res = 0;
+        for (auto const &t : sample_Transf16)
+            res += (t * t == t);
+        return res;
+    };
+    BENCHMARK_MEM_FN(is_idempotent_ref, sample_Transf16);
+    BENCHMARK_MEM_FN(is_idempotent, sample_Transf16);
+    BENCHMARK("is_idempotent_many") {
+        std::vector<uint64_t> out((sample_Transf16.size() + 63) / 64);
+        Transf16::is_idempotent_many(sample_Transf16.data(),
+                                     sample_Transf16.size(), out.data());
+        return out;
+    };
+}
@@ -0,0 +1,97 @@
+//****************************************************************************//
+//    Copyright (C) 2018-2024 Finn Smith <fls3@st-andrews.ac.uk>              //
+//    Copyright (C) 2018-2024 James Mitchell <jdm3@st-andrews.ac.uk>          //
+//    Copyright (C) 2018-2024 Florent Hivert <Florent.Hivert@lisn.fr>,        //
+//                                                                            //
+//  This file is part of HP-Combi <https://github.com/libsemigroups/HPCombi>  //
+//                                                                            //
+//  HP-Combi is free software: you can redistribute it and/or modify it       //
+//  under the terms of the GNU General Public License as published by the     //
+//  Free Software Foundation, either version 3 of the License, or             //
+//  (at your option) any later version.                                       //
+//                                                                            //
+//  HP-Combi is distributed in the hope that it will be useful, but WITHOUT   //
+//  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or     //
+//  FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License      //
+//  for  more details.                                                        //
+//                                                                            //
+//  You should have received a copy of the GNU General Public License along   //
+//  with HP-Combi. If not, see <https://www.gnu.org/licenses/>.               //
+//****************************************************************************//
+
+#include <atomic>   // for atomic
+#include <cstddef>  // for size_t
+#include <cstdint>  // for uint8_t, uint64_t
+#include <vector>   // for vector
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "bench_fixture.hpp"
+#include "bench_main.hpp"
+
+#include "hpcombi/perm16.hpp"
+#include "hpcombi/set_partition16.hpp"
+
+namespace HPCombi {
+
+// Recursive generation of the restricted growth strings
+void set_partitions_rec(size_t n, size_t i, uint8_t nb, SetPartition16 &p,
+                        std::vector<SetPartition16> &res) {
+    if (i == n) {
+        res.push_back(p);
+        return;
+    }
+    for (uint8_t b = 0; b <= nb; b++) {
+        p[i] = b;
+        set_partitions_rec(n, i + 1, b == nb ? nb + 1 : nb, p, res);
+    }
+}
+
+TEST_CASE("Kernels of 1000 random transformations", "[SetPartition16][000]") {
+    auto const sample = Transf16::random_many(1000);
+    BENCHMARK("from_labels_ref") {
+        epu8 res{};
+        for (auto const &t : sample)
+            res |= SetPartition16::from_labels_ref(t).v;
+        return res;
+    };
+    BENCHMARK("from_labels") {
+        epu8 res{};
+        for (auto const &t : sample)
+            res |= SetPartition16::from_labels(t).v;
+        return res;
+    };
+    BENCHMARK("join") {
+        epu8 res{};
+        for (size_t i = 1; i < sample.size(); i++)
+            res |= kernel(sample[i - 1]).join(kernel(sample[i])).v;
+        return res;
+    };
+    BENCHMARK("meet") {
+        epu8 res{};
+        for (size_t i = 1; i < sample.size(); i++)
+            res |= kernel(sample[i - 1]).meet(kernel(sample[i])).v;
+        return res;
+    };
+}
+
+TEST_CASE("All the 4213597 set partitions of 12", "[SetPartition16][001]") {
+    BENCHMARK("recursive") {
+        std::vector<SetPartition16> res;
+        SetPartition16 p = SetPartition16::one_block(12);
+        set_partitions_rec(12, 0, 0, p, res);
+        return res.size();
+    };
+    BENCHMARK("next_lex") { return SetPartition16::all(12).size(); };
+    BENCHMARK("for_each_batch") {
+        std::atomic<uint64_t> res(0);
+        SetPartition16::for_each_batch(
+            12, [&res](std::vector<SetPartition16> const &batch) {
+                res += batch.size();
+            });
+        return uint64_t(res);
+    };
+}
+
+}  // namespace HPCombi
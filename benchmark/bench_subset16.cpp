@@ -0,0 +1,85 @@
+//****************************************************************************//
+//     Copyright (C) 2016-2024 Florent Hivert <Florent.Hivert@lisn.fr>,       //
+//                                                                            //
+//  This file is part of HP-Combi <https://github.com/libsemigroups/HPCombi>  //
+//                                                                            //
+//  HP-Combi is free software: you can redistribute it and/or modify it       //
+//  under the terms of the GNU General Public License as published by the     //
+//  Free Software Foundation, either version 3 of the License, or             //
+//  (at your option) any later version.                                       //
+//                                                                            //
+//  HP-Combi is distributed in the hope that it will be useful, but WITHOUT   //
+//  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or     //
+//  FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License      //
+//  for  more details.                                                        //
+//                                                                            //
+//  You should have received a copy of the GNU General Public License along   //
+//  with HP-Combi. If not, see <https://www.gnu.org/licenses/>.               //
+//****************************************************************************//
+
+#include <cstddef>  // for size_t
+#include <cstdint>  // for uint16_t, uint32_t
+#include <vector>   // for vector
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "bench_fixture.hpp"
+#include "bench_main.hpp"
+
+#include "hpcombi/subset16.hpp"
+
+namespace HPCombi {
+
+// What examples/pattern.cpp does by hand in subset_to_perm
+inline epu8 to_gather_loop(Subset16 s) {
+    epu8 res = Epu8(0xFF);
+    size_t c = 0;
+    for (size_t i = 0; i < 16; i++)
+        if (s.contains(i))
+            res[c++] = i;
+    return res;
+}
+
+inline epu8 to_gather(Subset16 s) { return s.to_gather(); }
+
+class Fix_Subset16 {
+ public:
+    Fix_Subset16() : sample() {
+        for (uint32_t b = 0; b < 0x10000; b += 7)
+            sample.push_back(Subset16(uint16_t(b)));
+    }
+    ~Fix_Subset16() {}
+    std::vector<Subset16> sample;
+};
+
+TEST_CASE_METHOD(Fix_Subset16, "Subset16 to gather", "[Subset16][000]") {
+    BENCHMARK_LAMBDA("| lambda", to_gather_loop, sample);
+    BENCHMARK_LAMBDA("| lambda", to_gather, sample);
+}
+
+TEST_CASE("Enumeration of the 8-subsets of 16", "[Subset16][001]") {
+    BENCHMARK("filter popcount") {
+        size_t res = 0;
+        for (uint32_t b = 0; b < 0x10000; b++)
+            if (__builtin_popcount(b) == 8)
+                res += b;
+        return res;
+    };
+    BENCHMARK("for_each_k_subset") {
+        size_t res = 0;
+        Subset16::for_each_k_subset(16, 8,
+                                    [&res](Subset16 s) { res += s.bits(); });
+        return res;
+    };
+    BENCHMARK("next_colex") {
+        size_t res = 0;
+        Subset16 s = Subset16::first(8);
+        do {
+            res += s.bits();
+        } while (s.next_colex());
+        return res;
+    };
+}
+
+}  // namespace HPCombi
@@ -0,0 +1,124 @@
+//****************************************************************************//
+//    Copyright (C) 2018-2024 Finn Smith <fls3@st-andrews.ac.uk>              //
+//    Copyright (C) 2018-2024 James Mitchell <jdm3@st-andrews.ac.uk>          //
+//    Copyright (C) 2018-2024 Florent Hivert <Florent.Hivert@lisn.fr>,        //
+//                                                                            //
+//  This file is part of HP-Combi <https://github.com/libsemigroups/HPCombi>  //
+//                                                                            //
+//  HP-Combi is free software: you can redistribute it and/or modify it       //
+//  under the terms of the GNU General Public License as published by the     //
+//  Free Software Foundation, either version 3 of the License, or             //
+//  (at your option) any later version.                                       //
+//                                                                            //
+//  HP-Combi is distributed in the hope that it will be useful, but WITHOUT   //
+//  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or     //
+//  FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License      //
+//  for  more details.                                                        //
+//                                                                            //
+//  You should have received a copy of the GNU General Public License along   //
+//  with HP-Combi. If not, see <https://www.gnu.org/licenses/>.               //
+//****************************************************************************//
+
+#include <algorithm>  // for upper_bound, lower_bound
+#include <array>      // for array
+#include <cstddef>    // for size_t
+#include <cstdint>    // for uint8_t
+#include <vector>     // for vector
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "bench_fixture.hpp"
+#include "bench_main.hpp"
+
+#include "hpcombi/perm16.hpp"
+#include "hpcombi/tableau16.hpp"
+
+namespace HPCombi {
+
+// Scalar RSK, returning the shape, with rows stored in arrays
+Partition16 rsk_shape_ref(Perm16 const &p) {
+    std::array<std::array<uint8_t, 16>, 16> rows;
+    std::array<uint8_t, 16> len{};
+    for (size_t k = 0; k < 16; k++) {
+        uint8_t x = p[k];
+        for (size_t i = 0;; i++) {
+            auto end = rows[i].begin() + len[i];
+            auto it = std::upper_bound(rows[i].begin(), end, x);
+            if (it == end) {
+                *it = x;
+                len[i]++;
+                break;
+            }
+            std::swap(x, *it);
+        }
+    }
+    Partition16 res{};
+    for (size_t i = 0; i < 16; i++)
+        res[i] = len[i];
+    return res;
+}
+
+// Scalar patience sorting
+size_t lis_ref(Perm16 const &p) {
+    std::array<uint8_t, 16> piles;
+    size_t nb = 0;
+    for (size_t k = 0; k < 16; k++) {
+        auto it = std::lower_bound(piles.begin(), piles.begin() + nb, p[k]);
+        *it = p[k];
+        nb += (it == piles.begin() + nb);
+    }
+    return nb;
+}
+
+struct Fix_Tableau16 {
+    Fix_Tableau16() : sample(Perm16::random_many(1000)) {}
+    ~Fix_Tableau16() {}
+    std::vector<Perm16> const sample;
+};
+
+TEST_CASE_METHOD(Fix_Tableau16, "RSK shapes of 1000 Perm16",
+                 "[Tableau16][000]") {
+    BENCHMARK("rsk_shape_ref") {
+        std::vector<Partition16> out;
+        for (auto const &p : sample)
+            out.push_back(rsk_shape_ref(p));
+        return out;
+    };
+    BENCHMARK("rsk_shape") {
+        std::vector<Partition16> out;
+        for (auto const &p : sample)
+            out.push_back(rsk_shape(p));
+        return out;
+    };
+    BENCHMARK("rsk_shapes") {
+        std::vector<Partition16> out(sample.size());
+        rsk_shapes(sample.data(), sample.size(), out.data());
+        return out;
+    };
+    BENCHMARK("rsk") {
+        Partition16 res{};
+        for (auto const &p : sample)
+            res.v |= rsk(p).second.shape().v;
+        return res;
+    };
+}
+
+TEST_CASE_METHOD(Fix_Tableau16,
+                 "Distribution of the longest increasing subsequence",
+                 "[Tableau16][001]") {
+    BENCHMARK("patience sorting") {
+        std::array<size_t, 17> hist{};
+        for (auto const &p : sample)
+            hist[lis_ref(p)]++;
+        return hist;
+    };
+    BENCHMARK("longest_increasing_subsequence") {
+        std::array<size_t, 17> hist{};
+        for (auto const &p : sample)
+            hist[longest_increasing_subsequence(p)]++;
+        return hist;
+    };
+}
+
+}  // namespace HPCombi
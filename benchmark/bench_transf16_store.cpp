@@ -0,0 +1,82 @@
+//****************************************************************************//
+//    Copyright (C) 2018-2024 Finn Smith <fls3@st-andrews.ac.uk>              //
+//    Copyright (C) 2018-2024 James Mitchell <jdm3@st-andrews.ac.uk>          //
+//    Copyright (C) 2018-2024 Florent Hivert <Florent.Hivert@lisn.fr>,        //
+//                                                                            //
+//  This file is part of HP-Combi <https://github.com/libsemigroups/HPCombi>  //
+//                                                                            //
+//  HP-Combi is free software: you can redistribute it and/or modify it       //
+//  under the terms of the GNU General Public License as published by the     //
+//  Free Software Foundation, either version 3 of the License, or             //
+//  (at your option) any later version.                                       //
+//                                                                            //
+//  HP-Combi is distributed in the hope that it will be useful, but WITHOUT   //
+//  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or     //
+//  FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License      //
+//  for  more details.                                                        //
+//                                                                            //
+//  You should have received a copy of the GNU General Public License along   //
+//  with HP-Combi. If not, see <https://www.gnu.org/licenses/>.               //
+//****************************************************************************//
+
+#include <cstddef>        // for size_t
+#include <unordered_set>  // for unordered_set
+#include <utility>        // for swap
+#include <vector>         // for vector
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "bench_fixture.hpp"
+#include "bench_main.hpp"
+
+#include "hpcombi/perm16.hpp"
+#include "hpcombi/transf16_store.hpp"
+
+namespace HPCombi {
+
+// The full transformation monoid on 6 points, as in examples/Trans.cpp
+std::vector<Transf16> const trans6_gens{Transf16({1, 0, 2, 3, 4, 5}),
+                                        Transf16({1, 2, 3, 4, 5, 0}),
+                                        Transf16({0, 0, 2, 3, 4, 5})};
+
+std::unordered_set<Transf16> generated_unordered_set() {
+    std::unordered_set<Transf16> res{Transf16::one()};
+    std::vector<Transf16> todo{Transf16::one()}, newtodo;
+    while (!todo.empty()) {
+        newtodo.clear();
+        for (auto const &v : todo)
+            for (auto const &g : trans6_gens)
+                if (res.insert(v * g).second)
+                    newtodo.push_back(v * g);
+        std::swap(todo, newtodo);
+    }
+    return res;
+}
+
+TEST_CASE("Enumeration of the full transformation monoid T_6",
+          "[Transf16Store][000]") {
+    BENCHMARK("std::unordered_set") {
+        return generated_unordered_set().size();
+    };
+    BENCHMARK("Transf16Store::generated") {
+        return Transf16Store::generated(trans6_gens).size();
+    };
+}
+
+TEST_CASE("Elements of rank 13 of T_6", "[Transf16Store][001]") {
+    auto const set = generated_unordered_set();
+    auto const store = Transf16Store::generated(trans6_gens);
+    BENCHMARK("std::unordered_set and rank") {
+        std::vector<Transf16> res;
+        for (auto const &t : set)
+            if (t.rank() == 13)
+                res.push_back(t);
+        return res;
+    };
+    BENCHMARK("Transf16Store::elements_of_rank") {
+        return store.elements_of_rank(13);
+    };
+}
+
+}  // namespace HPCombi
@@ -0,0 +1,63 @@
+//****************************************************************************//
+//     Copyright (C) 2016-2024 Florent Hivert <Florent.Hivert@lisn.fr>,       //
+//                                                                            //
+//  This file is part of HP-Combi <https://github.com/libsemigroups/HPCombi>  //
+//                                                                            //
+//  HP-Combi is free software: you can redistribute it and/or modify it       //
+//  under the terms of the GNU General Public License as published by the     //
+//  Free Software Foundation, either version 3 of the License, or             //
+//  (at your option) any later version.                                       //
+//                                                                            //
+//  HP-Combi is distributed in the hope that it will be useful, but WITHOUT   //
+//  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or     //
+//  FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License      //
+//  for  more details.                                                        //
+//                                                                            //
+//  You should have received a copy of the GNU General Public License along   //
+//  with HP-Combi. If not, see <https://www.gnu.org/licenses/>.               //
+//****************************************************************************//
+
+#include <cstddef>  // for size_t
+#include <vector>   // for vector
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "bench_fixture.hpp"
+#include "bench_main.hpp"
+
+#include "hpcombi/tropmat8.hpp"
+
+namespace HPCombi {
+
+template <class Mat> std::vector<Mat> make_tropmat8_sample(size_t n) {
+    std::vector<Mat> res;
+    for (size_t i = 0; i < n; i++)
+        res.push_back(Mat::random());
+    return res;
+}
+
+#define BENCHMARK_TROPMAT8_PRODUCT(Mat)                                        \
+    auto sample = make_tropmat8_sample<Mat>(1000);                             \
+    BENCHMARK("mult_ref") {                                                    \
+        Mat res = Mat::one();                                                  \
+        for (auto const &m : sample)                                           \
+            res = res.mult_ref(m);                                             \
+        return res;                                                            \
+    };                                                                         \
+    BENCHMARK("operator*") {                                                   \
+        Mat res = Mat::one();                                                  \
+        for (auto const &m : sample)                                           \
+            res = res * m;                                                     \
+        return res;                                                            \
+    };
+
+TEST_CASE("Product of 1000 max-plus matrices", "[TropMat8][000]") {
+    BENCHMARK_TROPMAT8_PRODUCT(MaxPlusMat8<20>);
+}
+
+TEST_CASE("Product of 1000 min-plus matrices", "[TropMat8][001]") {
+    BENCHMARK_TROPMAT8_PRODUCT(MinPlusMat8<20>);
+}
+
+}  // namespace HPCombi
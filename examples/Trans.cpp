@@ -19,6 +19,7 @@
 
 #include <array>
 #include <cassert>
+#include <cstddef>
 #include <cstdint>
 #include <functional>  // less<>
 #include <iostream>
@@ -31,6 +32,7 @@
 #endif
 
 #include "hpcombi/perm16.hpp"
+#include "hpcombi/transf16_store.hpp"
 
 using HPCombi::Transf16;
 
@@ -96,5 +98,13 @@ int main() {
                   << ", #Bucks = " << res.bucket_count() << std::endl;
     }
     std::cout << "res =  " << res.size() << std::endl;
+
+    // Same enumeration, stored by rank and image
+    auto store = HPCombi::Transf16Store::generated(gens);
+    for (size_t rank = 0; rank <= 16; rank++)
+        if (store.size_of_rank(rank) != 0)
+            std::cout << "rank " << rank << " : " << store.size_of_rank(rank)
+                      << " elements, " << store.images_of_rank(rank).size()
+                      << " images" << std::endl;
     exit(0);
 }
@@ -37,10 +37,17 @@
 
 #include "debug.hpp"   // for HPCOMBI_ASSERT
 #include "epu8.hpp"    // for epu8
+#include "hash.hpp"    // for FastHash
 #include "perm16.hpp"  // for Perm16
+#include "power.hpp"   // for Monoid
+#include "random.hpp"  // for random_stream
+
+#include "simde/x86/avx2.h"  // for simde_mm256_shuffle_epi8, ...
 
 namespace HPCombi {
 
+struct BMat8Invariants;
+
 /** Boolean matrices of dimension up to 8×8, stored as a single uint64;
 isomorph to binary relations with methods for composition.
 
@@ -187,6 +194,22 @@ class BMat8 {
         return mult_transpose(that.transpose());
     }
 
+    //! Returns whether \c this is idempotent, that is equal to its square
+    //!
+    //! The row @f$i@f$ of the square is the union of the rows @f$j@f$ of
+    //! \c this such that the entry @f$(i, j)@f$ is set. These unions are
+    //! computed with the rotations of #mult_transpose, but without any
+    //! transposition.
+    bool is_idempotent() const noexcept;
+
+    //! Returns whether \c this is a regular element of the monoid of
+    //! boolean matrices, that is whether @f$xyx = x@f$ for some @f$y@f$
+    //!
+    //! The largest @f$y@f$ such that @f$xyx \leq x@f$ is the complement of
+    //! @f$x^T \bar{x} x^T@f$, so that no search is needed; this costs four
+    //! #mult_transpose and a single transposition.
+    bool is_regular_element() const noexcept;
+
     //! Returns a canonical basis of the row space of \c this
     //!
     //! Any two matrix with the same row space are guaranteed to have the same
@@ -206,6 +229,15 @@ class BMat8 {
     //! Returns the number of non-zero rows of \c this
     size_t nr_rows() const noexcept;
 
+    //! Returns the invariants of \c this, see #HPCombi::BMat8Invariants
+    //!
+    //! The rows of \c this and of its transpose are loaded in the two
+    //! halves of a single register, so that the computations on the rows
+    //! and on the columns are done by the same instructions. The size of
+    //! the column space is not computed since it is equal to the size of
+    //! the row space.
+    BMat8Invariants invariants() const noexcept;
+
     //! Returns a \c std::vector for rows of \c this
     // Not noexcept because it constructs a vector
     std::vector<uint8_t> rows() const;
@@ -279,6 +311,35 @@ class BMat8 {
     static std::pair<bool, bool> row_space_included2(BMat8 a1, BMat8 b1,
                                                      BMat8 a2, BMat8 b2);
 
+    //! Returns inclusion of the row space of \p a in those of \p n matrices
+    //!
+    //! Sets the bit @f$j@f$ of the bitmap \p out, that is the bit
+    //! @f$j \bmod 64@f$ of <tt>out[j / 64]</tt>, if the row space of \p a is
+    //! included in the row space of <tt>bs[j]</tt>; \p out must hold
+    //! @f$\lceil n/64 \rceil@f$ words, which are overwritten.
+    //! Uses the algorithm of #row_space_included on four matrices per
+    //! iteration in a 256 bits register.
+    static void row_space_included_many(BMat8 a, BMat8 const *bs, size_t n,
+                                        uint64_t *out) noexcept;
+
+    //! Returns inclusion of the row spaces of \p n matrices in that of \p b
+    //!
+    //! Sets the bit @f$j@f$ of the bitmap \p out if the row space of
+    //! <tt>as[j]</tt> is included in the row space of \p b; see the other
+    //! overload for the format of \p out. The rotations of \p b are
+    //! computed once.
+    static void row_space_included_many(BMat8 const *as, size_t n, BMat8 b,
+                                        uint64_t *out) noexcept;
+
+    //! Returns which of \p n matrices are idempotent
+    //!
+    //! Sets the bit @f$j@f$ of the bitmap \p out if <tt>xs[j]</tt> is
+    //! idempotent; see #row_space_included_many for the format of \p out.
+    //! Uses the algorithm of #is_idempotent on four matrices per iteration
+    //! in a 256 bits register.
+    static void is_idempotent_many(BMat8 const *xs, size_t n,
+                                   uint64_t *out) noexcept;
+
     //! Returns the matrix whose rows have been permuted according to \c p
     //!
     //! @param p : a permutation fixing the entries 8..15
@@ -323,7 +384,7 @@ class BMat8 {
     //! This method returns the 8 x 8 BMat8 with 1s on the main diagonal.
     static BMat8 one(size_t dim = 8) noexcept {
         HPCOMBI_ASSERT(dim <= 8);
-        static std::array<uint64_t, 9> const ones = {
+        static constexpr std::array<uint64_t, 9> ones = {
             0x0000000000000000, 0x8000000000000000, 0x8040000000000000,
             0x8040200000000000, 0x8040201000000000, 0x8040201008000000,
             0x8040201008040000, 0x8040201008040200, 0x8040201008040201};
@@ -343,6 +404,19 @@ class BMat8 {
     // Not noexcept because BMat8::random above is not
     static BMat8 random(size_t dim);
 
+    //! Returns a random square BMat8 of dimension \p dim and given density.
+    //!
+    //! This method returns a BMat8 where each of the top-left \p dim x \p dim
+    //! entries is 1 with probability \p density, rounded to a multiple of
+    //! 1/256, independently of the others. Uses 64 random bytes compared to
+    //! the density and gathered with movemask.
+    static BMat8 random(size_t dim, double density);
+
+    //! Returns a vector of \p count random BMat8 of dimension \p dim and
+    //! given density; see random(size_t, double).
+    static std::vector<BMat8> random_many(size_t count, size_t dim = 8,
+                                          double density = 0.5);
+
     void swap(BMat8 &that) noexcept { std::swap(this->_data, that._data); }
 
     //! Write \c this on \c os
@@ -360,6 +434,31 @@ class BMat8 {
     epu8 row_space_basis_internal() const noexcept;
 };
 
+/** The invariants of a #HPCombi::BMat8 computed at once by
+ * #HPCombi::BMat8::invariants */
+struct BMat8Invariants {
+    //! The size of the row space, see #HPCombi::BMat8::row_space_size
+    uint64_t row_space_size;
+    //! The size of the column space
+    uint64_t col_space_size;
+    //! The number of non-zero rows
+    size_t nr_rows;
+    //! The number of non-zero columns
+    size_t nr_cols;
+    //! The numbers of ones in the rows sorted increasingly in the entries
+    //! 0 to 7; the other entries are 0
+    epu8 row_popcounts;
+    //! The numbers of ones in the columns, as for #row_popcounts
+    epu8 col_popcounts;
+    //! See #HPCombi::BMat8::row_space_basis
+    BMat8 row_space_basis;
+    //! See #HPCombi::BMat8::col_space_basis
+    BMat8 col_space_basis;
+};
+
+//! The hash key of a #HPCombi::BMat8 is its 64 bits representation
+inline uint64_t hash_key(BMat8 const &bm) noexcept { return bm.to_int(); }
+
 }  // namespace HPCombi
 
 #include "bmat8_impl.hpp"
@@ -367,7 +466,7 @@ class BMat8 {
 namespace std {
 template <> struct hash<HPCombi::BMat8> {
     inline size_t operator()(HPCombi::BMat8 const &bm) const {
-        return hash<uint64_t>()(bm.to_int());
+        return HPCombi::FastHash<HPCombi::BMat8>{}(bm);
     }
 };
 }  // namespace std
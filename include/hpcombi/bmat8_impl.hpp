@@ -28,79 +28,79 @@
 namespace HPCombi {
 static_assert(std::is_trivial<BMat8>(), "BMat8 is not a trivial class!");
 
-static const constexpr std::array<uint64_t, 8> ROW_MASK = {
+inline constexpr std::array<uint64_t, 8> ROW_MASK = {
     {0xff00000000000000, 0xff000000000000, 0xff0000000000, 0xff00000000,
      0xff000000, 0xff0000, 0xff00, 0xff}};
 
-static const constexpr std::array<uint64_t, 8> COL_MASK = {
+inline constexpr std::array<uint64_t, 8> COL_MASK = {
     0x8080808080808080, 0x4040404040404040, 0x2020202020202020,
     0x1010101010101010, 0x808080808080808,  0x404040404040404,
     0x202020202020202,  0x101010101010101};
 
-static const constexpr std::array<uint64_t, 64> BIT_MASK = {{0x8000000000000000,
-                                                             0x4000000000000000,
-                                                             0x2000000000000000,
-                                                             0x1000000000000000,
-                                                             0x800000000000000,
-                                                             0x400000000000000,
-                                                             0x200000000000000,
-                                                             0x100000000000000,
-                                                             0x80000000000000,
-                                                             0x40000000000000,
-                                                             0x20000000000000,
-                                                             0x10000000000000,
-                                                             0x8000000000000,
-                                                             0x4000000000000,
-                                                             0x2000000000000,
-                                                             0x1000000000000,
-                                                             0x800000000000,
-                                                             0x400000000000,
-                                                             0x200000000000,
-                                                             0x100000000000,
-                                                             0x80000000000,
-                                                             0x40000000000,
-                                                             0x20000000000,
-                                                             0x10000000000,
-                                                             0x8000000000,
-                                                             0x4000000000,
-                                                             0x2000000000,
-                                                             0x1000000000,
-                                                             0x800000000,
-                                                             0x400000000,
-                                                             0x200000000,
-                                                             0x100000000,
-                                                             0x80000000,
-                                                             0x40000000,
-                                                             0x20000000,
-                                                             0x10000000,
-                                                             0x8000000,
-                                                             0x4000000,
-                                                             0x2000000,
-                                                             0x1000000,
-                                                             0x800000,
-                                                             0x400000,
-                                                             0x200000,
-                                                             0x100000,
-                                                             0x80000,
-                                                             0x40000,
-                                                             0x20000,
-                                                             0x10000,
-                                                             0x8000,
-                                                             0x4000,
-                                                             0x2000,
-                                                             0x1000,
-                                                             0x800,
-                                                             0x400,
-                                                             0x200,
-                                                             0x100,
-                                                             0x80,
-                                                             0x40,
-                                                             0x20,
-                                                             0x10,
-                                                             0x8,
-                                                             0x4,
-                                                             0x2,
-                                                             0x1}};
+inline constexpr std::array<uint64_t, 64> BIT_MASK = {{0x8000000000000000,
+                                                       0x4000000000000000,
+                                                       0x2000000000000000,
+                                                       0x1000000000000000,
+                                                       0x800000000000000,
+                                                       0x400000000000000,
+                                                       0x200000000000000,
+                                                       0x100000000000000,
+                                                       0x80000000000000,
+                                                       0x40000000000000,
+                                                       0x20000000000000,
+                                                       0x10000000000000,
+                                                       0x8000000000000,
+                                                       0x4000000000000,
+                                                       0x2000000000000,
+                                                       0x1000000000000,
+                                                       0x800000000000,
+                                                       0x400000000000,
+                                                       0x200000000000,
+                                                       0x100000000000,
+                                                       0x80000000000,
+                                                       0x40000000000,
+                                                       0x20000000000,
+                                                       0x10000000000,
+                                                       0x8000000000,
+                                                       0x4000000000,
+                                                       0x2000000000,
+                                                       0x1000000000,
+                                                       0x800000000,
+                                                       0x400000000,
+                                                       0x200000000,
+                                                       0x100000000,
+                                                       0x80000000,
+                                                       0x40000000,
+                                                       0x20000000,
+                                                       0x10000000,
+                                                       0x8000000,
+                                                       0x4000000,
+                                                       0x2000000,
+                                                       0x1000000,
+                                                       0x800000,
+                                                       0x400000,
+                                                       0x200000,
+                                                       0x100000,
+                                                       0x80000,
+                                                       0x40000,
+                                                       0x20000,
+                                                       0x10000,
+                                                       0x8000,
+                                                       0x4000,
+                                                       0x2000,
+                                                       0x1000,
+                                                       0x800,
+                                                       0x400,
+                                                       0x200,
+                                                       0x100,
+                                                       0x80,
+                                                       0x40,
+                                                       0x20,
+                                                       0x10,
+                                                       0x8,
+                                                       0x4,
+                                                       0x2,
+                                                       0x1}};
 
 inline bool BMat8::operator()(size_t i, size_t j) const noexcept {
     HPCOMBI_ASSERT(i < 8);
@@ -132,13 +132,7 @@ inline BMat8::BMat8(std::vector<std::vector<bool>> const &mat) {
     }
 }
 
-inline BMat8 BMat8::random() {
-    static std::random_device _rd;
-    static std::mt19937 _gen(_rd());
-    static std::uniform_int_distribution<uint64_t> _dist(0, 0xffffffffffffffff);
-
-    return BMat8(_dist(_gen));
-}
+inline BMat8 BMat8::random() { return BMat8(random_stream()()); }
 
 inline BMat8 BMat8::random(size_t const dim) {
     HPCOMBI_ASSERT(0 < dim && dim <= 8);
@@ -150,6 +144,39 @@ inline BMat8 BMat8::random(size_t const dim) {
     return bm;
 }
 
+inline BMat8 BMat8::random(size_t const dim, double const density) {
+    HPCOMBI_ASSERT(0 < dim && dim <= 8);
+    HPCOMBI_ASSERT(0 <= density && density <= 1);
+    RandomStream &gen = random_stream();
+    uint64_t res;
+    if (density >= 1) {
+        res = ~uint64_t(0);
+    } else {
+        epu8 thresh = Epu8(uint8_t(density * 256));
+        res = 0;
+        for (size_t i = 0; i < 64; i += 16) {
+            epu8 bytes = gen.next128();
+            res |= uint64_t(uint16_t(simde_mm_movemask_epi8(bytes < thresh)))
+                   << i;
+        }
+    }
+    BMat8 bm(res);
+    for (size_t i = dim; i < 8; ++i) {
+        bm._data &= ~ROW_MASK[i];
+        bm._data &= ~COL_MASK[i];
+    }
+    return bm;
+}
+
+inline std::vector<BMat8> BMat8::random_many(size_t count, size_t dim,
+                                             double density) {
+    std::vector<BMat8> res;
+    res.reserve(count);
+    for (size_t i = 0; i < count; i++)
+        res.push_back(random(dim, density));
+    return res;
+}
+
 inline BMat8 BMat8::transpose() const noexcept {
     uint64_t x = _data;
     uint64_t y = (x ^ (x >> 7)) & 0xAA00AA00AA00AA;
@@ -199,12 +226,12 @@ inline void BMat8::transpose2(BMat8 &a, BMat8 &b) noexcept {
     b._data = simde_mm_extract_epi64(x, 0);
 }
 
-static constexpr epu8 rotlow{7, 0, 1, 2, 3, 4, 5, 6};
-static constexpr epu8 rothigh{0,  1, 2, 3,  4,  5,  6,  7,
+inline constexpr epu8 rotlow{7, 0, 1, 2, 3, 4, 5, 6};
+inline constexpr epu8 rothigh{0,  1, 2, 3,  4,  5,  6,  7,
                               15, 8, 9, 10, 11, 12, 13, 14};
-static constexpr epu8 rotboth{7,  0, 1, 2,  3,  4,  5,  6,
+inline constexpr epu8 rotboth{7,  0, 1, 2,  3,  4,  5,  6,
                               15, 8, 9, 10, 11, 12, 13, 14};
-static constexpr epu8 rot2{6,  7,  0, 1, 2,  3,  4,  5,
+inline constexpr epu8 rot2{6,  7,  0, 1, 2,  3,  4,  5,
                            14, 15, 8, 9, 10, 11, 12, 13};
 
 inline BMat8 BMat8::mult_transpose(BMat8 const &that) const noexcept {
@@ -223,6 +250,31 @@ inline BMat8 BMat8::mult_transpose(BMat8 const &that) const noexcept {
                  simde_mm_extract_epi64(data, 1));
 }
 
+inline bool BMat8::is_idempotent() const noexcept {
+    epu8 x = simde_mm_set_epi64x(_data, _data);
+    // Lane i of y holds the row (i + k) % 8 in the low half and the row
+    // (i + k + 1) % 8 in the high half, whose column is selected by diag
+    epu8 y = simde_mm_shuffle_epi8(x, rothigh);
+    epu8 data{};
+    epu8 diag{0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80,
+              0x80, 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40};
+    for (int i = 0; i < 4; ++i) {
+        data |= ((x & diag) != epu8{}) & y;
+        y = simde_mm_shuffle_epi8(y, rot2);
+        diag = simde_mm_shuffle_epi8(diag, rot2);
+    }
+    return uint64_t(simde_mm_extract_epi64(data, 0) |
+                    simde_mm_extract_epi64(data, 1)) == _data;
+}
+
+inline bool BMat8::is_regular_element() const noexcept {
+    // y is the complement of t ~x t where t is the transpose of x
+    BMat8 t = transpose();
+    BMat8 u = t.mult_transpose(BMat8(~t._data));  // t ~x
+    BMat8 yt = BMat8(~mult_transpose(u)._data);   // the transpose of y
+    return mult_transpose(yt).mult_transpose(t) == *this;
+}
+
 inline epu8 BMat8::row_space_basis_internal() const noexcept {
     epu8 res = remove_dups(revsorted8(simde_mm_set_epi64x(0, _data)));
     epu8 rescy = res;
@@ -246,7 +298,7 @@ inline BMat8 BMat8::row_space_basis() const noexcept {
 #endif  // FF
 #define FF 0xff
 
-constexpr std::array<epu8, 4> masks{{
+inline constexpr std::array<epu8, 4> masks{{
     // clang-format off
       {FF, 0,FF, 0,FF, 0,FF, 0,FF, 0,FF, 0,FF, 0,FF, 0}, // NOLINT()
       {FF,FF, 1, 1,FF,FF, 1, 1,FF,FF, 1, 1,FF,FF, 1, 1}, // NOLINT()
@@ -255,15 +307,18 @@ constexpr std::array<epu8, 4> masks{{
     }};
 #undef FF
 
-static const epu8 shiftres{1, 2, 4, 8, 0x10, 0x20, 0x40, 0x80};
+inline constexpr epu8 shiftres =
+    Epu8([](uint8_t i) { return i < 8 ? 1 << i : 0; });
 
 namespace detail {
 
+// The bytes whose 5 high bits select the first and second half of the
+// 256 bits set
+inline constexpr epu8 bound08 = Epu8([](uint8_t i) { return 8 * i; });
+inline constexpr epu8 bound18 = Epu8([](uint8_t i) { return 8 * i + 0x80; });
+
 inline void row_space_update_bitset(epu8 block, epu8 &set0, epu8 &set1)
 noexcept {
-    static const epu8 bound08 = simde_mm_slli_epi32(
-        static_cast<simde__m128i>(Epu8.id()), 3);  // shift for *8
-    static const epu8 bound18 = bound08 + Epu8(0x80);
     for (size_t slice8 = 0; slice8 < 16; slice8++) {
         epu8 bm5 = Epu8(0xf8) & block; /* 11111000 */
         epu8 shft = simde_mm_shuffle_epi8(shiftres, block - bm5);
@@ -373,6 +428,103 @@ inline std::pair<bool, bool> BMat8::row_space_included2(BMat8 a0, BMat8 b0,
                           simde_mm_extract_epi64(res, 1) == -1);
 }
 
+namespace detail {
+
+inline simde__m256i load_bmat8x4(BMat8 const *p) noexcept {
+    return simde_mm256_loadu_si256(reinterpret_cast<simde__m256i const *>(p));
+}
+
+// Bit i is set if the i-th 64 bits lanes of a and b are equal
+inline uint64_t equal_lanes_mask(simde__m256i a, simde__m256i b) noexcept {
+    return simde_mm256_movemask_pd(
+        simde_mm256_castsi256_pd(simde_mm256_cmpeq_epi64(a, b)));
+}
+
+inline void clear_bitmap(uint64_t *out, size_t n) noexcept {
+    std::fill(out, out + (n + 63) / 64, 0);
+}
+
+}  // namespace detail
+
+inline void BMat8::row_space_included_many(BMat8 a, BMat8 const *bs,
+                                           size_t n, uint64_t *out) noexcept {
+    static_assert(sizeof(BMat8) == 8, "BMat8 is not packed");
+    detail::clear_bitmap(out, n);
+    const simde__m256i rot = simde_mm256_set_m128i(rotboth, rotboth);
+    const simde__m256i block = simde_mm256_set1_epi64x(a._data);
+    size_t j = 0;
+    for (; j + 4 <= n; j += 4) {
+        simde__m256i in = detail::load_bmat8x4(bs + j);
+        simde__m256i orincl = simde_mm256_and_si256(
+            simde_mm256_cmpeq_epi8(simde_mm256_or_si256(in, block), block), in);
+        for (int i = 0; i < 7; i++) {  // Only rotating
+            in = simde_mm256_shuffle_epi8(in, rot);
+            orincl = simde_mm256_or_si256(
+                orincl,
+                simde_mm256_and_si256(
+                    simde_mm256_cmpeq_epi8(simde_mm256_or_si256(in, block),
+                                           block),
+                    in));
+        }
+        out[j / 64] |= detail::equal_lanes_mask(block, orincl) << (j % 64);
+    }
+    for (; j < n; j++)
+        out[j / 64] |= uint64_t(a.row_space_included(bs[j])) << (j % 64);
+}
+
+inline void BMat8::row_space_included_many(BMat8 const *as, size_t n,
+                                           BMat8 b, uint64_t *out) noexcept {
+    static_assert(sizeof(BMat8) == 8, "BMat8 is not packed");
+    detail::clear_bitmap(out, n);
+    const simde__m256i rot = simde_mm256_set_m128i(rotboth, rotboth);
+    simde__m256i ins[8];
+    ins[0] = simde_mm256_set1_epi64x(b._data);
+    for (size_t i = 1; i < 8; i++)
+        ins[i] = simde_mm256_shuffle_epi8(ins[i - 1], rot);
+    size_t j = 0;
+    for (; j + 4 <= n; j += 4) {
+        simde__m256i block = detail::load_bmat8x4(as + j);
+        simde__m256i orincl = simde_mm256_setzero_si256();
+        for (simde__m256i in : ins)
+            orincl = simde_mm256_or_si256(
+                orincl,
+                simde_mm256_and_si256(
+                    simde_mm256_cmpeq_epi8(simde_mm256_or_si256(in, block),
+                                           block),
+                    in));
+        out[j / 64] |= detail::equal_lanes_mask(block, orincl) << (j % 64);
+    }
+    for (; j < n; j++)
+        out[j / 64] |= uint64_t(as[j].row_space_included(b)) << (j % 64);
+}
+
+inline void BMat8::is_idempotent_many(BMat8 const *xs, size_t n,
+                                      uint64_t *out) noexcept {
+    static_assert(sizeof(BMat8) == 8, "BMat8 is not packed");
+    detail::clear_bitmap(out, n);
+    const simde__m256i rot = simde_mm256_set_m128i(rotboth, rotboth);
+    const simde__m256i zero = simde_mm256_setzero_si256();
+    size_t j = 0;
+    for (; j + 4 <= n; j += 4) {
+        simde__m256i x = detail::load_bmat8x4(xs + j);
+        simde__m256i y = x, square = zero;
+        simde__m256i diag = simde_mm256_set1_epi64x(0x8040201008040201);
+        for (int i = 0; i < 8; ++i) {
+            square = simde_mm256_or_si256(
+                square,
+                simde_mm256_andnot_si256(
+                    simde_mm256_cmpeq_epi8(simde_mm256_and_si256(x, diag),
+                                           zero),
+                    y));
+            y = simde_mm256_shuffle_epi8(y, rot);
+            diag = simde_mm256_shuffle_epi8(diag, rot);
+        }
+        out[j / 64] |= detail::equal_lanes_mask(x, square) << (j % 64);
+    }
+    for (; j < n; j++)
+        out[j / 64] |= uint64_t(xs[j].is_idempotent()) << (j % 64);
+}
+
 inline std::bitset<256> BMat8::row_space_bitset_ref() const {
     std::bitset<256> lookup;
     std::vector<uint8_t> row_vec = row_space_basis().rows();
@@ -419,8 +571,37 @@ inline size_t BMat8::nr_rows() const noexcept {
     return __builtin_popcountll(simde_mm_movemask_epi8(x != epu8{}));
 }
 
-static constexpr epu8 rev8{7, 6, 5,  4,  3,  2,  1,  0,
-                                   8, 9, 10, 11, 12, 13, 14, 15};
+// Shift each half of an epu8 right, inserting 0 at the entries 0 and 8
+inline constexpr epu8 shift_right_halves{0xFF, 0, 1, 2,  3,  4,  5,  6,
+                                         0xFF, 8, 9, 10, 11, 12, 13, 14};
+
+inline BMat8Invariants BMat8::invariants() const noexcept {
+    BMat8Invariants res;
+    // rows in the low half, columns in the high half
+    epu8 x = simde_mm_set_epi64x(transpose()._data, _data);
+    uint32_t nonzero = simde_mm_movemask_epi8(x != epu8{});
+    res.nr_rows = __builtin_popcount(nonzero & 0xFF);
+    res.nr_cols = __builtin_popcount(nonzero >> 8);
+    epu8 pop = sorted8(popcount16(x));
+    res.row_popcounts = simde_mm_move_epi64(pop);
+    res.col_popcounts = simde_mm_srli_si128(pop, 8);
+    // Same as row_space_basis_internal on both halves
+    epu8 basis = revsorted8(x);
+    basis &= basis != permuted(basis, shift_right_halves);
+    epu8 rescy = basis, orincl{};
+    for (int i = 0; i < 7; i++) {
+        rescy = permuted(rescy, rotboth);
+        orincl |= ((rescy | basis) == basis) & rescy;
+    }
+    basis = sorted8((basis != orincl) & basis);
+    res.row_space_basis = BMat8(simde_mm_extract_epi64(basis, 0));
+    res.col_space_basis = BMat8(simde_mm_extract_epi64(basis, 1)).transpose();
+    res.row_space_size = res.col_space_size = row_space_size();
+    return res;
+}
+
+inline constexpr epu8 rev8{7, 6, 5,  4,  3,  2,  1,  0,
+                           8, 9, 10, 11, 12, 13, 14, 15};
 
 inline BMat8 BMat8::row_permuted(Perm16 p) const noexcept {
     epu8 x = simde_mm_set_epi64x(0, _data);
@@ -501,6 +682,15 @@ inline std::ostream &BMat8::write(std::ostream &os) const {
     return os;
 }
 
+namespace power_helper {
+
+template <> struct Monoid<BMat8> {
+    static const BMat8 one() { return BMat8::one(); }
+    static BMat8 prod(BMat8 a, BMat8 b) { return a * b; }
+};
+
+}  // namespace power_helper
+
 }  // namespace HPCombi
 
 namespace std {
@@ -0,0 +1,125 @@
+//****************************************************************************//
+//    Copyright (C) 2018-2024 Finn Smith <fls3@st-andrews.ac.uk>              //
+//    Copyright (C) 2018-2024 James Mitchell <jdm3@st-andrews.ac.uk>          //
+//    Copyright (C) 2018-2024 Florent Hivert <Florent.Hivert@lisn.fr>,        //
+//                                                                            //
+//  This file is part of HP-Combi <https://github.com/libsemigroups/HPCombi>  //
+//                                                                            //
+//  HP-Combi is free software: you can redistribute it and/or modify it       //
+//  under the terms of the GNU General Public License as published by the     //
+//  Free Software Foundation, either version 3 of the License, or             //
+//  (at your option) any later version.                                       //
+//                                                                            //
+//  HP-Combi is distributed in the hope that it will be useful, but WITHOUT   //
+//  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or     //
+//  FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License      //
+//  for  more details.                                                        //
+//                                                                            //
+//  You should have received a copy of the GNU General Public License along   //
+//  with HP-Combi. If not, see <https://www.gnu.org/licenses/>.               //
+//****************************************************************************//
+
+/** @file
+@brief declaration of HPCombi::BMat8Orbits */
+
+#ifndef HPCOMBI_BMAT8_ORBITS_HPP_
+#define HPCOMBI_BMAT8_ORBITS_HPP_
+
+#include <algorithm>  // for max, next_permutation
+#include <array>      // for array
+#include <atomic>     // for atomic
+#include <cstddef>    // for size_t
+#include <cstdint>    // for uint64_t, uint8_t
+#include <mutex>      // for mutex, lock_guard
+#include <numeric>    // for iota
+#include <utility>    // for forward
+#include <vector>     // for vector
+
+#include "bmat8.hpp"     // for BMat8
+#include "debug.hpp"     // for HPCOMBI_ASSERT
+#include "epu8.hpp"      // for epu8, sorted8
+#include "parallel.hpp"  // for for_each_batch_threaded
+
+namespace HPCombi {
+
+/** The boolean matrices of dimension \c dim up to permutations of their rows
+and of their columns.
+
+The representative of an orbit is its largest element for
+#HPCombi::BMat8::to_int, that is for the lexicographic order of the rows read
+from the top. Both its rows and its columns are therefore decreasing, with
+all its entries in the top left \c dim × \c dim corner, as for the matrices
+returned by #HPCombi::BMat8::random(size_t).
+
+@par Algorithm:
+Orderly generation: the rows are chosen one at a time in decreasing order,
+and a partial matrix is discarded as soon as two adjacent columns are out of
+order, which can not be repaired by the next rows. The complete matrices are
+then tested for canonicity against all the @f$\mathrm{dim}!@f$ permutations
+of the columns. A permutation of the columns of all the rows is a pair of
+nibble lookups with #HPCombi::permuted, so that each test costs two shuffles
+and a #HPCombi::sorted8.
+
+The search tree is cut after its first two rows into independent tasks,
+which are distributed dynamically among the threads.
+*/
+class BMat8Orbits {
+ public:
+    /** The orbits of the matrices of dimension \p dim, for @f$0 <
+     * \mathrm{dim} \leq 8@f$; this builds a table of 32 bytes for each of
+     * the @f$\mathrm{dim}!@f$ permutations of the columns. */
+    explicit BMat8Orbits(size_t dim);
+
+    //! The dimension of the matrices
+    size_t dim() const noexcept { return _dim; }
+
+    /** The representative of the orbit of \p x, which must have all its
+     * entries in the top left #dim × #dim corner */
+    BMat8 canonical(BMat8 x) const noexcept;
+
+    //! Whether \p x is the representative of its orbit
+    bool is_canonical(BMat8 x) const noexcept;
+
+    /** Call \p fun on the representatives of all the orbits, in batches.
+     * @param fun a callable taking a <tt>std::vector<BMat8> const &</tt>;
+     *    it is called concurrently from several threads when \p nr_threads
+     *    is not 1, and must then be thread safe
+     * @param nr_threads the number of threads; 0 means
+     *    <tt>std::thread::hardware_concurrency()</tt>
+     * @param batch_size the maximal size of the batches passed to \p fun
+     * @details The order of the representatives is not specified.
+     */
+    template <typename Fun>
+    void for_each_batch(Fun &&fun, size_t nr_threads = 0,
+                        size_t batch_size = 1024) const;
+
+    //! The representatives of all the orbits, sorted increasingly
+    std::vector<BMat8> all(size_t nr_threads = 0) const;
+
+    //! The number of orbits
+    uint64_t count(size_t nr_threads = 0) const;
+
+ private:
+    struct Task {
+        uint64_t data;     // the rows chosen so far
+        size_t depth;      // the number of rows chosen so far
+        uint8_t last;      // the last row chosen, on dim bits
+        uint8_t eq_cols;   // bit dim-2-j is set if columns j, j+1 are equal
+    };
+
+    template <typename Fun> void children(Task const &t, Fun &&fun) const;
+    template <typename Visit> void search(Task const &t, Visit &visit) const;
+    std::vector<Task> tasks() const;
+    uint64_t max_permuted(uint64_t x, bool stop_above) const noexcept;
+
+    size_t _dim;
+    // For each permutation of the columns, the images of the low and of the
+    // high nibble of a row
+    std::vector<std::array<epu8, 2>> _tables;
+};
+
+}  // namespace HPCombi
+
+#include "bmat8_orbits_impl.hpp"
+
+#endif  // HPCOMBI_BMAT8_ORBITS_HPP_
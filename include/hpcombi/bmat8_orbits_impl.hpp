@@ -0,0 +1,147 @@
+//****************************************************************************//
+//    Copyright (C) 2018-2024 Finn Smith <fls3@st-andrews.ac.uk>              //
+//    Copyright (C) 2018-2024 James Mitchell <jdm3@st-andrews.ac.uk>          //
+//    Copyright (C) 2018-2024 Florent Hivert <Florent.Hivert@lisn.fr>,        //
+//                                                                            //
+//  This file is part of HP-Combi <https://github.com/libsemigroups/HPCombi>  //
+//                                                                            //
+//  HP-Combi is free software: you can redistribute it and/or modify it       //
+//  under the terms of the GNU General Public License as published by the     //
+//  Free Software Foundation, either version 3 of the License, or             //
+//  (at your option) any later version.                                       //
+//                                                                            //
+//  HP-Combi is distributed in the hope that it will be useful, but WITHOUT   //
+//  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or     //
+//  FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License      //
+//  for  more details.                                                        //
+//                                                                            //
+//  You should have received a copy of the GNU General Public License along   //
+//  with HP-Combi. If not, see <https://www.gnu.org/licenses/>.               //
+//****************************************************************************//
+
+// NOLINT(build/header_guard)
+
+/** @file
+@brief implementation of bmat8_orbits.hpp ; this file should not be included
+directly.
+*/
+
+namespace HPCombi {
+
+inline BMat8Orbits::BMat8Orbits(size_t dim) : _dim(dim), _tables() {
+    HPCOMBI_ASSERT(0 < dim && dim <= 8);
+    std::array<uint8_t, 8> p;
+    std::iota(p.begin(), p.end(), 0);
+    do {
+        // Column j of a row, that is bit 7 - j, is sent to column p[j]
+        auto image = [&p, dim](uint8_t row) {
+            uint8_t res = 0;
+            for (size_t j = 0; j < dim; ++j)
+                if (row & (0x80 >> j))
+                    res |= 0x80 >> p[j];
+            return res;
+        };
+        std::array<epu8, 2> tab;
+        for (uint8_t v = 0; v < 16; ++v) {
+            tab[0][v] = image(v);
+            tab[1][v] = image(v << 4);
+        }
+        _tables.push_back(tab);
+    } while (std::next_permutation(p.begin(), p.begin() + dim));
+}
+
+inline uint64_t BMat8Orbits::max_permuted(uint64_t x,
+                                          bool stop_above) const noexcept {
+    epu8 rows = simde_mm_set_epi64x(0, x);
+    epu8 lo = rows & Epu8(0x0F);
+    epu8 hi = rows >> 4;
+    uint64_t res = 0;
+    for (auto const &tab : _tables) {
+        epu8 res8 = sorted8(permuted(tab[0], lo) | permuted(tab[1], hi));
+        uint64_t y = simde_mm_extract_epi64(res8, 0);
+        if (y > res) {
+            res = y;
+            if (stop_above && y > x)
+                break;
+        }
+    }
+    return res;
+}
+
+inline BMat8 BMat8Orbits::canonical(BMat8 x) const noexcept {
+    HPCOMBI_ASSERT(x == BMat8::one(_dim) * x * BMat8::one(_dim));
+    return BMat8(max_permuted(x.to_int(), false));
+}
+
+inline bool BMat8Orbits::is_canonical(BMat8 x) const noexcept {
+    HPCOMBI_ASSERT(x == BMat8::one(_dim) * x * BMat8::one(_dim));
+    // The identity sorts the rows, which can only increase x
+    return max_permuted(x.to_int(), true) == x.to_int();
+}
+
+template <typename Fun>
+void BMat8Orbits::children(Task const &t, Fun &&fun) const {
+    uint8_t const mask = (1 << (_dim - 1)) - 1;
+    for (int r = t.last; r >= 0; --r) {
+        // Bit dim - 2 - j of a and b is the entry of r in column j and j + 1
+        uint8_t const a = (r >> 1) & mask, b = r & mask;
+        if (t.eq_cols & ~a & b)
+            continue;
+        uint64_t row = uint64_t(r << (8 - _dim)) << (8 * (7 - t.depth));
+        fun(Task{t.data | row, t.depth + 1, uint8_t(r),
+                 uint8_t(t.eq_cols & ~(a ^ b))});
+    }
+}
+
+template <typename Visit>
+void BMat8Orbits::search(Task const &t, Visit &visit) const {
+    if (t.depth == _dim) {
+        if (is_canonical(BMat8(t.data)))
+            visit(BMat8(t.data));
+        return;
+    }
+    children(t, [this, &visit](Task const &c) { search(c, visit); });
+}
+
+inline std::vector<BMat8Orbits::Task> BMat8Orbits::tasks() const {
+    uint8_t const full = (1 << _dim) - 1;
+    std::vector<Task> res{Task{0, 0, full, uint8_t(full >> 1)}};
+    for (size_t depth = 0; depth < std::min<size_t>(2, _dim); ++depth) {
+        std::vector<Task> next;
+        for (auto const &t : res)
+            children(t, [&next](Task const &c) { next.push_back(c); });
+        res.swap(next);
+    }
+    return res;
+}
+
+template <typename Fun>
+void BMat8Orbits::for_each_batch(Fun &&fun, size_t nr_threads,
+                                 size_t batch_size) const {
+    detail::for_each_batch_threaded<BMat8>(
+        tasks(), [this](Task const &t, auto &visit) { search(t, visit); },
+        std::forward<Fun>(fun), nr_threads, batch_size);
+}
+
+inline std::vector<BMat8> BMat8Orbits::all(size_t nr_threads) const {
+    std::vector<BMat8> res;
+    std::mutex mtx;
+    for_each_batch(
+        [&res, &mtx](std::vector<BMat8> const &batch) {
+            std::lock_guard<std::mutex> lock(mtx);
+            res.insert(res.end(), batch.begin(), batch.end());
+        },
+        nr_threads);
+    std::sort(res.begin(), res.end());
+    return res;
+}
+
+inline uint64_t BMat8Orbits::count(size_t nr_threads) const {
+    std::atomic<uint64_t> res(0);
+    for_each_batch(
+        [&res](std::vector<BMat8> const &batch) { res += batch.size(); },
+        nr_threads);
+    return res;
+}
+
+}  // namespace HPCombi
@@ -33,6 +33,12 @@
 
 namespace HPCombi {
 
+namespace detail {
+constexpr size_t log2_size(size_t n) {
+    return n <= 1 ? 0 : 1 + log2_size(n / 2);
+}
+}  // namespace detail
+
 /** Given a transformation from 0..15 → 0..15,
  * build at compile-time the array representing the transformation.
  *
@@ -120,7 +126,7 @@ template <class TPU> struct TPUBuild {
     }
     /// Left shift \c TPU, duplicating the rightmost entry
     constexpr TPU left_dup() const {
-        return (*this)([](type_elem i) { return i == 15 ? 15 : i + 1; });
+        return (*this)([](type_elem i) { return i == size - 1 ? i : i + 1; });
     }
     /// Right shift \c TPU, duplicating the leftmost entry
     constexpr TPU right_dup() const {
@@ -135,6 +141,35 @@ template <class TPU> struct TPUBuild {
                     ((i & 0x40) != 0 ? 1 : 0) + ((i & 0x80) != 0 ? 1 : 0));
         });
     }
+
+    /// Number of rounds of #sorting_rounds
+    static constexpr size_t nb_sorting_rounds =
+        detail::log2_size(size) * (detail::log2_size(size) + 1) / 2;
+
+    /** The rounds of a sorting network on \c TPU computed at compile time
+     * @details In the format of #HPCombi::network_sort: in each round the
+     * entry @f$i@f$ is compared with the entry @f$r[i]@f$ and receives the
+     * minimum if @f$i < r[i]@f$.
+     * @par Algorithm:
+     * Bitonic sorting network where all comparators are ascending: the first
+     * round of the stage merging blocks of size @f$k@f$ compares @f$i@f$ with
+     * its mirror @f$i \oplus (k - 1)@f$, the following ones compare @f$i@f$
+     * with @f$i \oplus j@f$ for @f$j = k/4, \dots, 1@f$.
+     */
+    constexpr std::array<TPU, nb_sorting_rounds> sorting_rounds() const {
+        static_assert((size & (size - 1)) == 0,
+                      "the size of TPU must be a power of two");
+        std::array<TPU, nb_sorting_rounds> res{};
+        size_t r = 0;
+        for (size_t k = 2; k <= size; k *= 2) {
+            res[r++] =
+                (*this)([k](type_elem i) { return type_elem(i ^ (k - 1)); });
+            for (size_t j = k / 4; j > 0; j /= 2)
+                res[r++] =
+                    (*this)([j](type_elem i) { return type_elem(i ^ j); });
+        }
+        return res;
+    }
 };
 
 /** Cast a TPU to a c++ \c std::array
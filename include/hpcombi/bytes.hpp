@@ -0,0 +1,145 @@
+//****************************************************************************//
+//     Copyright (C) 2023-2024 Florent Hivert <Florent.Hivert@lisn.fr>,       //
+//                                                                            //
+//  This file is part of HP-Combi <https://github.com/libsemigroups/HPCombi>  //
+//                                                                            //
+//  HP-Combi is free software: you can redistribute it and/or modify it       //
+//  under the terms of the GNU General Public License as published by the     //
+//  Free Software Foundation, either version 3 of the License, or             //
+//  (at your option) any later version.                                       //
+//                                                                            //
+//  HP-Combi is distributed in the hope that it will be useful, but WITHOUT   //
+//  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or     //
+//  FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License      //
+//  for  more details.                                                        //
+//                                                                            //
+//  You should have received a copy of the GNU General Public License along   //
+//  with HP-Combi. If not, see <https://www.gnu.org/licenses/>.               //
+//****************************************************************************//
+
+/** @file
+@brief Lexicographic comparison of byte arrays, four SIMD registers at a time
+
+These are the array versions of HPCombi::first_diff, HPCombi::last_diff and
+HPCombi::less; they are used by HPCombi::VectGeneric, and by the overloads on
+arrays of HPCombi::epu8 declared in epu8.hpp.
+*/
+
+#ifndef HPCOMBI_BYTES_HPP_
+#define HPCOMBI_BYTES_HPP_
+
+#include <cstddef>  // for size_t
+#include <cstdint>  // for uint8_t, uint64_t
+
+#include "simde/x86/sse4.1.h"  // for simde_mm_testz_si128, simde_mm_cmpeq...
+
+namespace HPCombi {
+
+namespace detail {
+
+// The xor of the 16 bytes at a and b
+inline simde__m128i xor_bytes(uint8_t const *a, uint8_t const *b) noexcept {
+    return simde_mm_xor_si128(
+        simde_mm_loadu_si128(reinterpret_cast<simde__m128i const *>(a)),
+        simde_mm_loadu_si128(reinterpret_cast<simde__m128i const *>(b)));
+}
+// The bit mask of the non zero bytes of x
+inline uint64_t non_zero_mask(simde__m128i x) noexcept {
+    simde__m128i zero = simde_mm_cmpeq_epi8(x, simde_mm_setzero_si128());
+    return uint16_t(~simde_mm_movemask_epi8(zero));
+}
+inline bool is_zero(simde__m128i x) noexcept {
+    return simde_mm_testz_si128(x, x);
+}
+
+}  // namespace detail
+
+/**
+ * @brief The first difference between two byte arrays
+ * @details
+ * @param a, b : pointers to \p n bytes, with no alignment requirement
+ * @param n : the length of the arrays
+ * @returns the smallest index @f$i<n@f$ such that \c a[i] and \c b[i]
+ * differ, \p n if the arrays are equal.
+ * @par Algorithm:
+ * Four registers of 16 bytes are compared per iteration and the loop exits
+ * as soon as one of them differs; the index is then read on the movemasks.
+ */
+inline size_t first_diff(uint8_t const *a, uint8_t const *b,
+                         size_t n) noexcept {
+    size_t i = 0;
+    for (; i + 64 <= n; i += 64) {
+        simde__m128i x0 = detail::xor_bytes(a + i, b + i);
+        simde__m128i x1 = detail::xor_bytes(a + i + 16, b + i + 16);
+        simde__m128i x2 = detail::xor_bytes(a + i + 32, b + i + 32);
+        simde__m128i x3 = detail::xor_bytes(a + i + 48, b + i + 48);
+        if (!detail::is_zero(simde_mm_or_si128(simde_mm_or_si128(x0, x1),
+                                               simde_mm_or_si128(x2, x3)))) {
+            uint64_t mask = detail::non_zero_mask(x0) |
+                            detail::non_zero_mask(x1) << 16 |
+                            detail::non_zero_mask(x2) << 32 |
+                            detail::non_zero_mask(x3) << 48;
+            return i + __builtin_ctzll(mask);
+        }
+    }
+    for (; i + 16 <= n; i += 16) {
+        simde__m128i x = detail::xor_bytes(a + i, b + i);
+        if (!detail::is_zero(x))
+            return i + __builtin_ctzll(detail::non_zero_mask(x));
+    }
+    for (; i < n; i++)
+        if (a[i] != b[i])
+            return i;
+    return n;
+}
+
+/**
+ * @brief The last difference between two byte arrays
+ * @details
+ * @param a, b : pointers to \p n bytes, with no alignment requirement
+ * @param n : the length of the arrays
+ * @returns the largest index @f$i<n@f$ such that \c a[i] and \c b[i]
+ * differ, \p n if the arrays are equal.
+ */
+inline size_t last_diff(uint8_t const *a, uint8_t const *b,
+                        size_t n) noexcept {
+    size_t i = n;
+    for (; i >= 64; i -= 64) {
+        uint8_t const *pa = a + i - 64, *pb = b + i - 64;
+        simde__m128i x0 = detail::xor_bytes(pa, pb);
+        simde__m128i x1 = detail::xor_bytes(pa + 16, pb + 16);
+        simde__m128i x2 = detail::xor_bytes(pa + 32, pb + 32);
+        simde__m128i x3 = detail::xor_bytes(pa + 48, pb + 48);
+        if (!detail::is_zero(simde_mm_or_si128(simde_mm_or_si128(x0, x1),
+                                               simde_mm_or_si128(x2, x3)))) {
+            uint64_t mask = detail::non_zero_mask(x0) |
+                            detail::non_zero_mask(x1) << 16 |
+                            detail::non_zero_mask(x2) << 32 |
+                            detail::non_zero_mask(x3) << 48;
+            return i - 1 - __builtin_clzll(mask);
+        }
+    }
+    for (; i >= 16; i -= 16) {
+        simde__m128i x = detail::xor_bytes(a + i - 16, b + i - 16);
+        if (!detail::is_zero(x))
+            return i - 1 - (__builtin_clzll(detail::non_zero_mask(x)) - 48);
+    }
+    while (i != 0) {
+        --i;
+        if (a[i] != b[i])
+            return i;
+    }
+    return n;
+}
+
+/** Lexicographic comparison of two byte arrays of length \p n
+ * @returns a negative, zero or positive int as \c memcmp
+ */
+inline int lex_compare(uint8_t const *a, uint8_t const *b, size_t n) noexcept {
+    size_t diff = first_diff(a, b, n);
+    return diff == n ? 0 : int(a[diff]) - int(b[diff]);
+}
+
+}  // namespace HPCombi
+
+#endif  // HPCOMBI_BYTES_HPP_
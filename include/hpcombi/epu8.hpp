@@ -26,14 +26,17 @@ eg simde_mm_testz_si128(a,a) → is_all_zero(a) */
 #ifndef HPCOMBI_EPU8_HPP_
 #define HPCOMBI_EPU8_HPP_
 
-#include <array>    // for array
-#include <cstddef>  // for size_t
-#include <cstdint>  // for uint8_t, uint64_t, int8_t
-#include <ostream>  // for ostream
-#include <string>   // for string
+#include <algorithm>  // for min
+#include <array>      // for array
+#include <cstddef>    // for size_t
+#include <cstdint>    // for uint8_t, uint64_t, int8_t
+#include <ostream>    // for ostream
+#include <string>     // for string
 
 #include "builder.hpp"       // for TPUBuild
+#include "bytes.hpp"         // for first_diff, lex_compare
 #include "debug.hpp"         // for HPCOMBI_ASSERT
+#include "random.hpp"        // for random_stream
 #include "vect_generic.hpp"  // for VectGeneric
 
 #include "simde/x86/sse4.1.h"  // for simde_mm_max_epu8, simde...
@@ -134,6 +137,28 @@ inline epu8 revsorted(epu8 a) noexcept;
  */
 inline epu8 revsorted8(epu8 a) noexcept;
 
+/** Same interface as \ref HPCombi::sorted_bounded "sorted_bounded" but with a
+ * different implementation.
+ * @details
+ * @par Algorithm: counting sort. For each value @f$u < Bound - 1@f$, the
+ * number @f$c_u@f$ of entries smaller than or equal to @f$u@f$ is computed
+ * with a comparison, a movemask and a popcount. Then the output entry at
+ * position @f$i@f$ is the number of @f$u@f$ such that @f$c_u \leq i@f$.
+ * This costs about @f$6(Bound - 1)@f$ instructions.
+ */
+template <uint8_t Bound> inline epu8 sorted_count(epu8 a) noexcept;
+
+/** Return a sorted #HPCombi::epu8 whose entries are known to be smaller
+ * than \c Bound
+ * @details
+ * @param a: an #HPCombi::epu8 with all entries smaller than \c Bound. This is
+ *    not checked.
+ * @par Algorithm: #sorted_count for small bounds (up to 5) where it is faster,
+ *    the sorting network of #sorted otherwise. The choice is done at compile
+ *    time.
+ */
+template <uint8_t Bound> inline epu8 sorted_bounded(epu8 a) noexcept;
+
 /** Sort \c this and return the sorting permutation
  * @details
  * @par Algorithm: Uses a 9 stages sorting network #sorting_rounds8
@@ -154,6 +179,47 @@ inline epu8 sort8_perm(epu8 &a) noexcept;
  */
 inline void merge(epu8 &a, epu8 &b) noexcept;
 
+/** A pair of #HPCombi::epu8 seen as a vector of 32 entries */
+using epu8x2 = std::array<epu8, 2>;
+
+/** Return the 32 entries of \c a sorted
+ * @details
+ * @par Algorithm: sort both halves with #sorted and #merge them
+ */
+inline epu8x2 sorted(epu8x2 a) noexcept;
+
+/**
+ * @brief Sort the \c 16*n entries stored in the \c n blocks starting at \c v
+ * @details after executing sort_blocks, each block is sorted and the last
+ * entry of a block is smaller than or equal to the first entry of the next.
+ * @par Algorithm: each block is sorted by #sorted, then the blocks go through
+ * Batcher's bitonic sorting network where each comparator is replaced by a
+ * #merge of two blocks. Missing blocks up to the next power of two are
+ * considered as filled with 0xFF and are never touched.
+ * This needs @f$O(n \log^2 n)@f$ calls to #merge.
+ */
+inline void sort_blocks(epu8 *v, size_t n) noexcept;
+
+/** Return the \c 16*N entries of \c a sorted
+ * @details
+ * @par Algorithm: see #sort_blocks
+ */
+template <size_t N>
+inline std::array<epu8, N> sorted(std::array<epu8, N> a) noexcept {
+    sort_blocks(a.data(), N);
+    return a;
+}
+
+/**
+ * @brief Sort \c keys and apply the same permutation to \c values
+ * @details after executing sort_by_key, \c keys is sorted and
+ * for all i, the new \c values[i] is the old value which was paired with
+ * the new \c keys[i]. The order of the values with equal keys is
+ * unspecified.
+ * @par Algorithm: #sort_perm followed by #permuted
+ */
+inline void sort_by_key(epu8 &keys, epu8 &values) noexcept;
+
 #ifdef SIMDE_X86_SSE4_2_NATIVE
 /** Same interface as \ref HPCombi::permutation_of "permutation_of" but with a
    different implementation.
@@ -188,6 +254,9 @@ constexpr uint64_t prime = 0x9e3779b97f4a7bb9;
  *    \c bnd must verify @f$ 0 < bnd \leq 256 @f$. This is not checked.
  * @returns a random #HPCombi::epu8 with value in the interval
  *    @f$[0, 1, 2, ..., bnd-1]@f$.
+ * @par Algorithm: 16 random bits per entry from #HPCombi::random_stream
+ *    scaled by a vector multiply high; the bias is less than
+ *    @f$bnd / 2^{16}@f$.
  */
 inline epu8 random_epu8(uint16_t bnd);
 
@@ -472,6 +541,58 @@ inline epu8 eval16_popcount(epu8 v) noexcept;
  */
 inline epu8 eval16(epu8 v) noexcept { return eval16_cycle(v); }
 
+/** @name Multisets of integers in 0..15
+ * A multiset of integers in 0..15 is encoded by its evaluation, that is the
+ * #HPCombi::epu8 whose \c i-th entry is the multiplicity of \c i, as
+ * returned by #eval16. The operations below work on evaluations and
+ * saturate at 255.
+ */
+///@{
+/** Union of two multisets: the multiplicities are the max */
+inline epu8 multiset_union(epu8 a, epu8 b) noexcept { return max(a, b); }
+/** Intersection of two multisets: the multiplicities are the min */
+inline epu8 multiset_intersection(epu8 a, epu8 b) noexcept {
+    return min(a, b);
+}
+/** Sum of two multisets: the multiplicities are added */
+inline epu8 multiset_sum(epu8 a, epu8 b) noexcept {
+    return simde_mm_adds_epu8(a, b);
+}
+/** Difference of two multisets: the multiplicities are subtracted,
+ * negative values being replaced by 0 */
+inline epu8 multiset_difference(epu8 a, epu8 b) noexcept {
+    return simde_mm_subs_epu8(a, b);
+}
+/** Test whether the multiset \c a is included in \c b */
+inline bool is_submultiset(epu8 a, epu8 b) noexcept {
+    return is_all_zero(multiset_difference(a, b));
+}
+///@}
+
+/** Test whether two #HPCombi::epu8 have the same content, that is whether
+ * one is obtained by permuting the entries of the other
+ * @details Contrary to comparing the #eval16, all 256 values are taken into
+ * account.
+ * @par Algorithm: compare the sorted vectors
+ */
+inline bool same_content(epu8 a, epu8 b) noexcept {
+    return equal(sorted(a), sorted(b));
+}
+
+/**
+ * @brief Histogram of the entries of \c n vectors
+ * @details
+ * @param v, n: the vectors <tt>v[0], ..., v[n-1]</tt>
+ * @returns the array \c r such that \c r[i] is the number of occurrences of
+ *     \c i among the \c 16*n entries
+ * @warning The entries larger than 15 are ignored
+ * @par Algorithm: the evaluations are accumulated in 8-bit counters for
+ *     blocks of 15 vectors, which are widened and accumulated in 16-bit
+ *     counters in registers, which are flushed to memory every 256 blocks.
+ *     This avoids the scalar accumulation of each #eval16 in memory.
+ */
+inline std::array<uint64_t, 16> histogram(epu8 const *v, size_t n) noexcept;
+
 /** Same interface as \ref HPCombi::first_diff "first_diff" but with a different
  * implementation.
  *  @par Algorithm:
@@ -571,6 +692,16 @@ inline bool less(epu8 a, epu8 b) noexcept;
  */
 inline int8_t less_partial(epu8 a, epu8 b, int k) noexcept;
 
+/** Same as \ref HPCombi::first_diff(uint8_t const *, uint8_t const *, size_t)
+ * "first_diff" on arrays of \p n #HPCombi::epu8; the result is the index of
+ * the first differing byte, \c 16*n if the arrays are equal.
+ */
+inline size_t first_diff(epu8 const *a, epu8 const *b, size_t n) noexcept;
+/** Lexicographic comparison of two arrays of \p n #HPCombi::epu8
+ * @returns a negative, zero or positive int as \c memcmp
+ */
+inline int lex_compare(epu8 const *a, epu8 const *b, size_t n) noexcept;
+
 /** return the index of the first zero entry or 16 if there are none
  *  Only index smaller than bound are taken into account.
  */
@@ -592,6 +723,14 @@ inline uint64_t last_non_zero(epu8 v, int bnd) noexcept;
  */
 inline epu8 popcount16(epu8 v) noexcept;
 
+/** Expand a bit mask into a vector mask
+ * @details
+ * @returns the vector whose @f$i@f$-th entry is \c 0xFF if the @f$i@f$-th bit
+ * of \c bits is set and \c 0 otherwise. This is the inverse of
+ * \c simde_mm_movemask_epi8.
+ */
+inline epu8 mask_from_bitset(uint32_t bits) noexcept;
+
 /** Test for partial transformation
  * @details
  * @returns whether \c v is a partial transformation.
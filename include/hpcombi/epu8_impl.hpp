@@ -118,6 +118,16 @@ inline int8_t less_partial(epu8 a, epu8 b, int k) noexcept {
                : static_cast<int8_t>(a[diff]) - static_cast<int8_t>(b[diff]);
 }
 
+inline size_t first_diff(epu8 const *a, epu8 const *b, size_t n) noexcept {
+    return first_diff(reinterpret_cast<uint8_t const *>(a),
+                      reinterpret_cast<uint8_t const *>(b), 16 * n);
+}
+
+inline int lex_compare(epu8 const *a, epu8 const *b, size_t n) noexcept {
+    return lex_compare(reinterpret_cast<uint8_t const *>(a),
+                       reinterpret_cast<uint8_t const *>(b), 16 * n);
+}
+
 inline uint64_t first_zero(epu8 v, int bnd) noexcept {
     return first_mask(v == epu8{}, bnd);
 }
@@ -214,6 +224,23 @@ inline epu8 revsorted8(epu8 a) noexcept {
     return network_sort<false>(a, sorting_rounds8);
 }
 
+template <uint8_t Bound> inline epu8 sorted_count(epu8 a) noexcept {
+    static_assert(0 < Bound && Bound <= 16, "Bound must be in [1, 16]");
+    epu8 res{};
+    for (uint8_t u = 0; u + 1 < Bound; u++) {
+        uint8_t cnt = __builtin_popcount(simde_mm_movemask_epi8(a <= Epu8(u)));
+        res -= (Epu8.id() >= Epu8(cnt));
+    }
+    return res;
+}
+template <uint8_t Bound> inline epu8 sorted_bounded(epu8 a) noexcept {
+    // Threshold measured in benchmark [Epu8][014]
+    if constexpr (Bound <= 5)
+        return sorted_count<Bound>(a);
+    else
+        return sorted(a);
+}
+
 inline epu8 sort_perm(epu8 &a) noexcept {
     return network_sort_perm<true>(a, sorting_rounds);
 }
@@ -246,16 +273,46 @@ inline void merge(epu8 &a, epu8 &b) noexcept {
 // TODO : compute merge_rounds on the fly instead of loading those from
 // memory
 
-inline epu8 random_epu8(uint16_t bnd) {
-    epu8 res;
+inline epu8x2 sorted(epu8x2 a) noexcept {
+    a[0] = sorted(a[0]);
+    a[1] = sorted(a[1]);
+    merge(a[0], a[1]);
+    return a;
+}
+
+inline void sort_blocks(epu8 *v, size_t n) noexcept {
+    for (size_t i = 0; i < n; i++)
+        v[i] = sorted(v[i]);
+    // Bitonic sorting network where all comparators are ascending. The first
+    // round of each stage compares i with its mirror i ^ (k - 1) in the block
+    // of size k. The comparators going beyond n are no-ops.
+    for (size_t k = 2; k < 2 * n; k *= 2) {
+        for (size_t i = 0; i < n; i++) {
+            size_t j = i ^ (k - 1);
+            if (i < j && j < n)
+                merge(v[i], v[j]);
+        }
+        for (size_t d = k / 4; d > 0; d /= 2) {
+            for (size_t i = 0; i < n; i++) {
+                size_t j = i ^ d;
+                if (i < j && j < n)
+                    merge(v[i], v[j]);
+            }
+        }
+    }
+}
 
-    static std::random_device rd;
-    static std::default_random_engine e1(rd());
-    std::uniform_int_distribution<int> uniform_dist(0, bnd - 1);
+inline void sort_by_key(epu8 &keys, epu8 &values) noexcept {
+    values = permuted(values, sort_perm(keys));
+}
 
-    for (size_t i = 0; i < 16; i++)
-        res[i] = uniform_dist(e1);
-    return res;
+inline epu8 random_epu8(uint16_t bnd) {
+    RandomStream &gen = random_stream();
+    simde__m128i b = simde_mm_set1_epi16(bnd);
+    // 16 random bits per entry scaled to [0, bnd) by multiply high
+    simde__m128i lo = simde_mm_mulhi_epu16(gen.next128(), b);
+    simde__m128i hi = simde_mm_mulhi_epu16(gen.next128(), b);
+    return simde_mm_packus_epi16(lo, hi);
 }
 
 inline epu8 remove_dups(epu8 v, uint8_t repl) noexcept {
@@ -478,11 +535,45 @@ inline epu8 eval16_popcount(epu8 v) noexcept {
     return res;
 }
 
+inline std::array<uint64_t, 16> histogram(epu8 const *v, size_t n) noexcept {
+    // 15 evaluations fit in 8 bits: 15 * 16 = 240 < 256.
+    // 256 blocks of those fit in 16 bits: 256 * 240 = 61440 < 65536.
+    constexpr size_t block8 = 15, block16 = 256;
+    std::array<uint64_t, 16> res{};
+    size_t i = 0;
+    while (i < n) {
+        simde__m128i lo = simde_mm_setzero_si128(),
+                     hi = simde_mm_setzero_si128();
+        for (size_t b = 0; b < block16 && i < n; b++) {
+            epu8 acc{};
+            size_t end = std::min(n, i + block8);
+            for (; i < end; i++)
+                acc += eval16(v[i]);
+            lo = simde_mm_add_epi16(lo, simde_mm_unpacklo_epi8(acc, epu8{}));
+            hi = simde_mm_add_epi16(hi, simde_mm_unpackhi_epi8(acc, epu8{}));
+        }
+        alignas(16) std::array<uint16_t, 16> cnt;
+        simde_mm_store_si128(reinterpret_cast<simde__m128i *>(cnt.data()), lo);
+        simde_mm_store_si128(reinterpret_cast<simde__m128i *>(cnt.data() + 8),
+                             hi);
+        for (size_t j = 0; j < 16; j++)
+            res[j] += cnt[j];
+    }
+    return res;
+}
+
 inline epu8 popcount16(epu8 v) noexcept {
     return (permuted(Epu8.popcount(), v & Epu8(0x0f)) +
             permuted(Epu8.popcount(), v >> 4));
 }
 
+inline epu8 mask_from_bitset(uint32_t bits) noexcept {
+    constexpr epu8 bit = Epu8([](uint8_t i) { return uint8_t(1 << (i & 7)); });
+    constexpr epu8 dup = Epu8([](uint8_t i) { return uint8_t(i >> 3); });
+    epu8 res = permuted(simde_mm_set1_epi16(bits), dup);
+    return (res & bit) == bit;
+}
+
 inline bool is_partial_transformation(epu8 v, const size_t k) noexcept {
     uint64_t diff = last_diff(v, Epu8.id(), 16);
     // (forall x in v, x + 1 <= 16)  and
@@ -578,7 +669,10 @@ template <> struct hash<HPCombi::epu8> {
     inline size_t operator()(HPCombi::epu8 a) const noexcept {
         unsigned __int128 v0 = simde_mm_extract_epi64(a, 0);
         unsigned __int128 v1 = simde_mm_extract_epi64(a, 1);
-        return ((v1 * HPCombi::prime + v0) * HPCombi::prime) >> 64;
+        // Folding the low half in avoids collisions of the high half alone
+        // on keys with few distinct bytes, see benchmark [Hash][000].
+        unsigned __int128 p = (v1 * HPCombi::prime + v0) * HPCombi::prime;
+        return uint64_t(p) ^ uint64_t(p >> 64);
 
         /* The following is extremely slow on Renner benchmark
            uint64_t v0 = simde_mm_extract_epi64(ar.v, 0);
@@ -0,0 +1,102 @@
+//****************************************************************************//
+//     Copyright (C) 2016-2024 Florent Hivert <Florent.Hivert@lisn.fr>,       //
+//                                                                            //
+//  This file is part of HP-Combi <https://github.com/libsemigroups/HPCombi>  //
+//                                                                            //
+//  HP-Combi is free software: you can redistribute it and/or modify it       //
+//  under the terms of the GNU General Public License as published by the     //
+//  Free Software Foundation, either version 3 of the License, or             //
+//  (at your option) any later version.                                       //
+//                                                                            //
+//  HP-Combi is distributed in the hope that it will be useful, but WITHOUT   //
+//  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or     //
+//  FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License      //
+//  for  more details.                                                        //
+//                                                                            //
+//  You should have received a copy of the GNU General Public License along   //
+//  with HP-Combi. If not, see <https://www.gnu.org/licenses/>.               //
+//****************************************************************************//
+
+/** @file
+@brief Hash functions for the HPCombi types, in a fast and a strong variant,
+and batched hashing */
+
+#ifndef HPCOMBI_HASH_HPP_
+#define HPCOMBI_HASH_HPP_
+
+#include <cstddef>     // for size_t
+#include <cstdint>     // for uint64_t
+#include <functional>  // for hash
+
+#include "epu8.hpp"    // for epu8, prime, hash<epu8>
+#include "random.hpp"  // for RandomStream::mix
+
+namespace HPCombi {
+
+/** @name Hash functions
+ * All the HPCombi types are hashed through a key, which is either a
+ * \c uint64_t or an #HPCombi::epu8, returned by an overload of \c hash_key
+ * found by argument dependent lookup. The key is then mixed by either
+ *  - #hash_fast: a single 64×64 → 128 bits multiply by #HPCombi::prime. This
+ *    is the hash used by the \c std::hash specializations.
+ *  - #hash_strong: the SplitMix64 finalizer, where each input bit affects all
+ *    output bits. Twice slower, but it does not degrade on structured key
+ *    sets when the low bits select the bucket.
+ */
+///@{
+/** Fast hash of a 64 bits key: the two halves of the 128 bits product of
+ * the key by #HPCombi::prime xored together */
+inline uint64_t hash_fast(uint64_t x) noexcept {
+    unsigned __int128 p = static_cast<unsigned __int128>(x) * prime;
+    return uint64_t(p) ^ uint64_t(p >> 64);
+}
+/** Fast hash of a 128 bits key; same as \c std::hash<epu8> */
+inline uint64_t hash_fast(epu8 x) noexcept { return std::hash<epu8>{}(x); }
+/** Strong hash of a 64 bits key: the SplitMix64 finalizer */
+inline uint64_t hash_strong(uint64_t x) noexcept {
+    return RandomStream::mix(x);
+}
+/** Strong hash of a 128 bits key: the SplitMix64 finalizer applied twice */
+inline uint64_t hash_strong(epu8 x) noexcept {
+    return RandomStream::mix(
+        RandomStream::mix(simde_mm_extract_epi64(x, 1)) +
+        simde_mm_extract_epi64(x, 0));
+}
+
+//! The key of a \c uint64_t is itself
+inline uint64_t hash_key(uint64_t x) noexcept { return x; }
+//! The key of an #HPCombi::epu8 is itself
+inline epu8 hash_key(epu8 x) noexcept { return x; }
+///@}
+
+/** Hash functor using #hash_fast on the key of \c T; usable as the \c Hash
+ * template parameter of unordered containers */
+template <typename T> struct FastHash {
+    size_t operator()(T const &x) const noexcept {
+        return hash_fast(hash_key(x));
+    }
+};
+
+/** Hash functor using #hash_strong on the key of \c T; usable as the \c Hash
+ * template parameter of unordered containers */
+template <typename T> struct StrongHash {
+    size_t operator()(T const &x) const noexcept {
+        return hash_strong(hash_key(x));
+    }
+};
+
+/**
+ * @brief Hash \p n keys at once
+ * @details Set <tt>out[i] = hasher(keys[i])</tt> for @f$0 \leq i < n@f$.
+ * @par Algorithm: a plain scalar loop; the keys are independent, so the
+ * processor overlaps their multiplications. See benchmark [Hash][000].
+ */
+template <typename T, typename Hasher = FastHash<T>>
+void hash_many(T const *keys, size_t n, uint64_t *out,
+               Hasher hasher = Hasher());
+
+}  // namespace HPCombi
+
+#include "hash_impl.hpp"
+
+#endif  // HPCOMBI_HASH_HPP_
@@ -0,0 +1,35 @@
+//****************************************************************************//
+//     Copyright (C) 2016-2024 Florent Hivert <Florent.Hivert@lisn.fr>,       //
+//                                                                            //
+//  This file is part of HP-Combi <https://github.com/libsemigroups/HPCombi>  //
+//                                                                            //
+//  HP-Combi is free software: you can redistribute it and/or modify it       //
+//  under the terms of the GNU General Public License as published by the     //
+//  Free Software Foundation, either version 3 of the License, or             //
+//  (at your option) any later version.                                       //
+//                                                                            //
+//  HP-Combi is distributed in the hope that it will be useful, but WITHOUT   //
+//  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or     //
+//  FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License      //
+//  for  more details.                                                        //
+//                                                                            //
+//  You should have received a copy of the GNU General Public License along   //
+//  with HP-Combi. If not, see <https://www.gnu.org/licenses/>.               //
+//****************************************************************************//
+
+// NOLINT(build/header_guard)
+
+/** @file
+@brief implementation of hash.hpp ; this file should not be included
+directly.
+*/
+
+namespace HPCombi {
+
+template <typename T, typename Hasher>
+void hash_many(T const *keys, size_t n, uint64_t *out, Hasher hasher) {
+    for (size_t i = 0; i < n; i++)
+        out[i] = hasher(keys[i]);
+}
+
+}  // namespace HPCombi
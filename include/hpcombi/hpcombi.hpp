@@ -25,11 +25,24 @@ and also debug.hpp, epu8.hpp, etc.*/
 #define HPCOMBI_HPCOMBI_HPP_
 
 #include "bmat8.hpp"
+#include "bmat8_orbits.hpp"
 #include "debug.hpp"
 #include "epu8.hpp"
+#include "hash.hpp"
+#include "lex_index.hpp"
+#include "partition16.hpp"
+#include "pattern.hpp"
 #include "perm16.hpp"
 #include "perm_generic.hpp"
 #include "power.hpp"
+#include "product_replacement.hpp"
+#include "random.hpp"
+#include "set_partition16.hpp"
+#include "subset16.hpp"
+#include "tableau16.hpp"
+#include "tpu.hpp"
+#include "transf16_store.hpp"
+#include "tropmat8.hpp"
 #include "vect16.hpp"
 #include "vect_generic.hpp"
 
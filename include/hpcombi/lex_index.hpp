@@ -0,0 +1,119 @@
+//****************************************************************************//
+//     Copyright (C) 2016-2024 Florent Hivert <Florent.Hivert@lisn.fr>,       //
+//                                                                            //
+//  This file is part of HP-Combi <https://github.com/libsemigroups/HPCombi>  //
+//                                                                            //
+//  HP-Combi is free software: you can redistribute it and/or modify it       //
+//  under the terms of the GNU General Public License as published by the     //
+//  Free Software Foundation, either version 3 of the License, or             //
+//  (at your option) any later version.                                       //
+//                                                                            //
+//  HP-Combi is distributed in the hope that it will be useful, but WITHOUT   //
+//  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or     //
+//  FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License      //
+//  for  more details.                                                        //
+//                                                                            //
+//  You should have received a copy of the GNU General Public License along   //
+//  with HP-Combi. If not, see <https://www.gnu.org/licenses/>.               //
+//****************************************************************************//
+
+/** @file
+@brief declaration of HPCombi::LexIndex */
+
+#ifndef HPCOMBI_LEX_INDEX_HPP_
+#define HPCOMBI_LEX_INDEX_HPP_
+
+#include <algorithm>  // for is_sorted
+#include <cstddef>    // for size_t
+#include <cstdint>    // for uint32_t, uint8_t
+#include <utility>    // for pair, move
+#include <vector>     // for vector
+
+#include "debug.hpp"  // for HPCOMBI_ASSERT
+#include "epu8.hpp"   // for epu8, less, equal
+
+namespace HPCombi {
+
+/** Static index over a sorted collection of #HPCombi::epu8, answering
+lexicographic range queries.
+
+The index is built once from a vector sorted for #HPCombi::less and is
+then read only. Note that \c std::less<epu8> is not lexicographic and
+cannot be used to sort the keys. All queries return ranks, that is
+positions in the sorted vector returned by #keys(). Duplicated keys are
+allowed.
+
+@par Algorithm:
+The keys are laid out as a static B-tree (an S-tree): each node is a cache
+line holding #node_size keys and the children of the node @f$k@f$ are the
+nodes @f$k(B+1)+1, \dots, k(B+1)+B+1@f$, so that no pointer is stored.
+A search reads a single cache line per level and compares the query with
+all the keys of the node without branching: for each key the bytes are
+compared with two SIMD instructions and the comparison is decided by the
+first differing byte, extracted with a bit trick on the movemasks.
+The height is @f$\log_{B+1} n@f$ instead of @f$\log_2 n@f$ for a binary search
+on the sorted vector, and the top levels stay in cache.
+*/
+class LexIndex {
+ public:
+    //! Number of keys in a node of the tree
+    static constexpr size_t node_size = 4;
+
+    //! An empty index
+    LexIndex() = default;
+
+    /** Build the index of \p sorted
+     * @details \p sorted must be sorted for #HPCombi::less; this is only
+     * checked in debug mode.
+     */
+    explicit LexIndex(std::vector<epu8> sorted);
+
+    //! The number of keys
+    size_t size() const noexcept { return _keys.size(); }
+
+    //! The sorted keys; the ranks returned by the queries index this vector
+    std::vector<epu8> const &keys() const noexcept { return _keys; }
+
+    //! The rank of the first key which is not less than \p x
+    size_t lower_bound(epu8 x) const noexcept;
+
+    //! The rank of the first key which is greater than \p x
+    size_t upper_bound(epu8 x) const noexcept;
+
+    //! Whether \p x is one of the keys
+    bool contains(epu8 x) const noexcept;
+
+    /** The range of ranks of the keys starting with the \p k first entries
+     * of \p prefix
+     * @details Returns the pair @f$(b, e)@f$ such that the keys of rank
+     * @f$b \leq r < e@f$ are exactly the keys whose first \p k entries
+     * agree with \p prefix; the other entries of \p prefix are ignored.
+     */
+    std::pair<size_t, size_t> prefix_range(epu8 prefix, size_t k) const
+        noexcept;
+
+    //! The number of keys starting with the \p k first entries of \p prefix
+    size_t prefix_count(epu8 prefix, size_t k) const noexcept {
+        auto range = prefix_range(prefix, k);
+        return range.second - range.first;
+    }
+
+ private:
+    struct alignas(64) Node {
+        epu8 key[node_size];
+    };
+
+    template <bool Strict> size_t search(epu8 x) const noexcept;
+    size_t build(std::vector<epu8> const &sorted, size_t k, size_t pos);
+
+    std::vector<epu8> _keys;
+    std::vector<Node> _nodes;
+    // rank of the key in each slot of the tree; size() for padding slots
+    std::vector<uint32_t> _ranks;
+};
+
+}  // namespace HPCombi
+
+#include "lex_index_impl.hpp"
+
+#endif  // HPCOMBI_LEX_INDEX_HPP_
@@ -0,0 +1,107 @@
+//****************************************************************************//
+//     Copyright (C) 2016-2024 Florent Hivert <Florent.Hivert@lisn.fr>,       //
+//                                                                            //
+//  This file is part of HP-Combi <https://github.com/libsemigroups/HPCombi>  //
+//                                                                            //
+//  HP-Combi is free software: you can redistribute it and/or modify it       //
+//  under the terms of the GNU General Public License as published by the     //
+//  Free Software Foundation, either version 3 of the License, or             //
+//  (at your option) any later version.                                       //
+//                                                                            //
+//  HP-Combi is distributed in the hope that it will be useful, but WITHOUT   //
+//  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or     //
+//  FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License      //
+//  for  more details.                                                        //
+//                                                                            //
+//  You should have received a copy of the GNU General Public License along   //
+//  with HP-Combi. If not, see <https://www.gnu.org/licenses/>.               //
+//****************************************************************************//
+
+// NOLINT(build/header_guard)
+
+/** @file
+@brief implementation of lex_index.hpp ; this file should not be
+included directly.
+*/
+
+namespace HPCombi {
+
+namespace detail {
+
+// Whether a < b lexicographically, without extracting the first differing
+// entry: it is the lowest set bit of the != mask, and a < b if this bit is
+// also set in the < mask.
+inline bool less_movemask(epu8 a, epu8 b) noexcept {
+    uint32_t ne = simde_mm_movemask_epi8(a != b);
+    uint32_t lt = simde_mm_movemask_epi8(a < b);
+    return (lt & ne & -ne) != 0;
+}
+
+}  // namespace detail
+
+inline LexIndex::LexIndex(std::vector<epu8> sorted)
+    : _keys(std::move(sorted)), _nodes(), _ranks() {
+    HPCOMBI_ASSERT(std::is_sorted(_keys.begin(), _keys.end(), less));
+    HPCOMBI_ASSERT(_keys.size() < (uint64_t(1) << 32));
+    size_t nodes = (_keys.size() + node_size - 1) / node_size;
+    _nodes.resize(nodes);
+    _ranks.resize(nodes * node_size);
+    build(_keys, 0, 0);
+}
+
+// Fill the subtree rooted at the node k in order with the keys from the
+// rank pos on; returns the rank following the last key of the subtree.
+inline size_t LexIndex::build(std::vector<epu8> const &sorted, size_t k,
+                              size_t pos) {
+    if (k >= _nodes.size())
+        return pos;
+    for (size_t i = 0; i < node_size; i++) {
+        pos = build(sorted, k * (node_size + 1) + i + 1, pos);
+        bool real = pos < sorted.size();
+        _nodes[k].key[i] = real ? sorted[pos] : Epu8(0xFF);
+        _ranks[k * node_size + i] = real ? pos : sorted.size();
+        pos++;
+    }
+    return build(sorted, k * (node_size + 1) + node_size + 1, pos);
+}
+
+template <bool Strict>
+inline size_t LexIndex::search(epu8 x) const noexcept {
+    size_t res = _keys.size();
+    size_t k = 0;
+    while (k < _nodes.size()) {
+        Node const &node = _nodes[k];
+        // number of keys of the node before x
+        size_t i = 0;
+        for (size_t j = 0; j < node_size; j++)
+            i += Strict ? !detail::less_movemask(x, node.key[j])
+                        : detail::less_movemask(node.key[j], x);
+        if (i < node_size)
+            res = _ranks[k * node_size + i];
+        k = k * (node_size + 1) + i + 1;
+    }
+    return res;
+}
+
+inline size_t LexIndex::lower_bound(epu8 x) const noexcept {
+    return search<false>(x);
+}
+
+inline size_t LexIndex::upper_bound(epu8 x) const noexcept {
+    return search<true>(x);
+}
+
+inline bool LexIndex::contains(epu8 x) const noexcept {
+    size_t r = lower_bound(x);
+    return r < _keys.size() && equal(_keys[r], x);
+}
+
+inline std::pair<size_t, size_t> LexIndex::prefix_range(epu8 prefix,
+                                                        size_t k) const
+    noexcept {
+    HPCOMBI_ASSERT(k <= 16);
+    epu8 mask = Epu8.id() < Epu8(uint8_t(k));
+    return {lower_bound(prefix & mask), upper_bound(prefix | ~mask)};
+}
+
+}  // namespace HPCombi
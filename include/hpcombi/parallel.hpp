@@ -0,0 +1,88 @@
+//****************************************************************************//
+//    Copyright (C) 2018-2024 Finn Smith <fls3@st-andrews.ac.uk>              //
+//    Copyright (C) 2018-2024 James Mitchell <jdm3@st-andrews.ac.uk>          //
+//    Copyright (C) 2018-2024 Florent Hivert <Florent.Hivert@lisn.fr>,        //
+//                                                                            //
+//  This file is part of HP-Combi <https://github.com/libsemigroups/HPCombi>  //
+//                                                                            //
+//  HP-Combi is free software: you can redistribute it and/or modify it       //
+//  under the terms of the GNU General Public License as published by the     //
+//  Free Software Foundation, either version 3 of the License, or             //
+//  (at your option) any later version.                                       //
+//                                                                            //
+//  HP-Combi is distributed in the hope that it will be useful, but WITHOUT   //
+//  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or     //
+//  FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License      //
+//  for  more details.                                                        //
+//                                                                            //
+//  You should have received a copy of the GNU General Public License along   //
+//  with HP-Combi. If not, see <https://www.gnu.org/licenses/>.               //
+//****************************************************************************//
+
+/** @file
+@brief declaration of HPCombi::detail::for_each_batch_threaded, the driver of
+the multithreaded enumerations */
+
+#ifndef HPCOMBI_PARALLEL_HPP_
+#define HPCOMBI_PARALLEL_HPP_
+
+#include <algorithm>  // for max, min
+#include <atomic>     // for atomic
+#include <cstddef>    // for size_t
+#include <thread>     // for thread
+#include <vector>     // for vector
+
+#include "debug.hpp"  // for HPCOMBI_ASSERT
+
+namespace HPCombi {
+
+namespace detail {
+
+/** Call \p fun on the elements enumerated from \p tasks, in batches.
+ * @tparam Elem the type of the elements
+ * @param tasks independent tasks, which are distributed dynamically among
+ *    the threads
+ * @param enumerate a callable such that <tt>enumerate(task, visit)</tt>
+ *    calls \c visit on each element of \c task
+ * @param fun a callable taking a <tt>std::vector<Elem> const &</tt>; it is
+ *    called concurrently from several threads when \p nr_threads is not 1
+ * @param nr_threads the number of threads; 0 means
+ *    <tt>std::thread::hardware_concurrency()</tt>
+ * @param batch_size the maximal size of the batches passed to \p fun
+ */
+template <typename Elem, typename Task, typename Enumerate, typename Fun>
+void for_each_batch_threaded(std::vector<Task> const &tasks,
+                             Enumerate &&enumerate, Fun &&fun,
+                             size_t nr_threads, size_t batch_size) {
+    HPCOMBI_ASSERT(batch_size > 0);
+    if (nr_threads == 0)
+        nr_threads = std::max<size_t>(1, std::thread::hardware_concurrency());
+    std::atomic<size_t> next(0);
+    auto worker = [&]() {
+        std::vector<Elem> batch;
+        batch.reserve(batch_size);
+        auto visit = [&](Elem const &x) {
+            batch.push_back(x);
+            if (batch.size() == batch_size) {
+                fun(static_cast<std::vector<Elem> const &>(batch));
+                batch.clear();
+            }
+        };
+        for (size_t i = next++; i < tasks.size(); i = next++)
+            enumerate(tasks[i], visit);
+        if (!batch.empty())
+            fun(static_cast<std::vector<Elem> const &>(batch));
+    };
+    std::vector<std::thread> threads;
+    for (size_t i = 1; i < std::min(nr_threads, tasks.size()); ++i)
+        threads.emplace_back(worker);
+    worker();
+    for (auto &th : threads)
+        th.join();
+}
+
+}  // namespace detail
+
+}  // namespace HPCombi
+
+#endif  // HPCOMBI_PARALLEL_HPP_
@@ -0,0 +1,284 @@
+//****************************************************************************//
+//    Copyright (C) 2018-2024 Finn Smith <fls3@st-andrews.ac.uk>              //
+//    Copyright (C) 2018-2024 James Mitchell <jdm3@st-andrews.ac.uk>          //
+//    Copyright (C) 2018-2024 Florent Hivert <Florent.Hivert@lisn.fr>,        //
+//                                                                            //
+//  This file is part of HP-Combi <https://github.com/libsemigroups/HPCombi>  //
+//                                                                            //
+//  HP-Combi is free software: you can redistribute it and/or modify it       //
+//  under the terms of the GNU General Public License as published by the     //
+//  Free Software Foundation, either version 3 of the License, or             //
+//  (at your option) any later version.                                       //
+//                                                                            //
+//  HP-Combi is distributed in the hope that it will be useful, but WITHOUT   //
+//  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or     //
+//  FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License      //
+//  for  more details.                                                        //
+//                                                                            //
+//  You should have received a copy of the GNU General Public License along   //
+//  with HP-Combi. If not, see <https://www.gnu.org/licenses/>.               //
+//****************************************************************************//
+
+/** @file
+@brief declaration of
+\ref HPCombi::Partition16 "Partition16" and
+\ref HPCombi::Composition16 "Composition16"
+*/
+
+#ifndef HPCOMBI_PARTITION16_HPP_
+#define HPCOMBI_PARTITION16_HPP_
+
+#include <array>             // for array
+#include <cstddef>           // for size_t
+#include <cstdint>           // for uint8_t, uint16_t, uint64_t
+#include <functional>        // for hash
+#include <initializer_list>  // for initializer_list
+#include <type_traits>       // for is_trivial
+#include <vector>            // for vector
+
+#include "debug.hpp"     // for HPCOMBI_ASSERT
+#include "epu8.hpp"      // for epu8, partial_sums, eval16, revsorted
+#include "hash.hpp"      // for FastHash
+#include "perm16.hpp"    // for Perm16
+#include "subset16.hpp"  // for Subset16
+#include "vect16.hpp"    // for Vect16
+
+namespace HPCombi {
+
+namespace detail {
+
+/** The number @f$p(n, m)@f$ of partitions of @f$n@f$ whose parts are at most
+ * @f$m@f$, for @f$0 \leq n, m \leq 16@f$ */
+constexpr std::array<std::array<uint16_t, 17>, 17> partition_counts = [] {
+    std::array<std::array<uint16_t, 17>, 17> res{};
+    for (size_t m = 0; m < 17; m++)
+        res[0][m] = 1;
+    for (size_t n = 1; n < 17; n++)
+        for (size_t m = 1; m < 17; m++)
+            res[n][m] = res[n][m - 1] + (m <= n ? res[n - m][m] : 0);
+    return res;
+}();
+
+}  // namespace detail
+
+/** Integer partitions of @f$n \leq 16@f$.
+
+The parts are stored in non increasing order, padded with zeros, so that
+#HPCombi::Vect16::sum is @f$n@f$. The comparison operators of
+#HPCombi::Vect16 are then the lexicographic order.
+
+The partitions of @f$n@f$ are ranked in reverse lexicographic order, starting
+with @f$(n)@f$ and ending with @f$(1^n)@f$, which is the order of #all.
+*/
+struct alignas(16) Partition16 : public Vect16 {
+    using vect = HPCombi::Vect16;
+
+    Partition16() = default;
+    constexpr Partition16(const Partition16 &v) = default;
+    /* implicit */ constexpr Partition16(const vect v) : Vect16(v) {}  // NOLINT
+    /* implicit */ constexpr Partition16(const epu8 x) : Vect16(x) {}  // NOLINT
+    Partition16(std::initializer_list<uint8_t> il) : Vect16(il) {}
+    Partition16 &operator=(const Partition16 &) = default;
+
+    //! Return whether \c *this is a well constructed object
+    bool validate() const;
+
+    //! The number of non zero parts of \c *this
+    size_t length() const noexcept {
+        return __builtin_popcount(simde_mm_movemask_epi8(v != epu8{}));
+    }
+
+    /** The conjugate partition, whose Young diagram is the transpose of the
+     * one of \c *this
+     * @par Algorithm: the part @f$j@f$ of the conjugate is the number of
+     * parts larger than @f$j@f$, that is 16 minus the partial sums of
+     * #HPCombi::eval16; a part 16, which is ignored by
+     * #HPCombi::eval16, is correctly counted as larger than every @f$j@f$.
+     */
+    Partition16 conjugate() const noexcept {
+        return Epu8(16) - HPCombi::partial_sums(HPCombi::eval16(v));
+    }
+
+    /** Whether \c *this dominates \p other, which must be a partition of
+     * the same integer
+     * @par Algorithm: compares the #HPCombi::partial_sums.
+     */
+    bool dominates(Partition16 const &other) const noexcept;
+
+    /** Replace \c *this by the next partition of the same integer in
+     * lexicographic order
+     * @returns \c false and resets \c *this to @f$(1^n)@f$ if \c *this was
+     * @f$(n)@f$, \c true otherwise, in the manner of
+     * \c std::next_permutation.
+     * @par Algorithm: the last part which can be increased by one, that is
+     * which is not preceded by an equal part, is incremented and the rest is
+     * replaced by ones; each step is a constant number of vector
+     * instructions.
+     */
+    bool next_lex() noexcept;
+
+    /** Replace \c *this by the next partition of the same integer in
+     * reverse lexicographic order
+     * @returns \c false and resets \c *this to @f$(n)@f$ if \c *this was
+     * @f$(1^n)@f$, \c true otherwise.
+     * @par Algorithm: the last part @f$p > 1@f$ is decremented and the
+     * following ones are replaced by as many parts @f$p - 1@f$ as possible
+     * and a remainder; each step is a constant number of vector
+     * instructions.
+     */
+    bool next_revlex() noexcept;
+
+    //! The rank of \c *this among the partitions of the same integer
+    size_t rank() const noexcept;
+
+    /** The partition of \p n of rank \p r; inverse of #rank.
+     * @details \p r must be smaller than #count(n).
+     */
+    static Partition16 unrank(size_t n, size_t r) noexcept;
+
+    //! The number of partitions of \p n
+    static size_t count(size_t n) noexcept {
+        HPCOMBI_ASSERT(n <= 16);
+        return detail::partition_counts[n][n];
+    }
+
+    //! The partition @f$(n)@f$, which is the first one for #rank
+    static Partition16 first(size_t n) noexcept {
+        HPCOMBI_ASSERT(n <= 16);
+        return Partition16(epu8{uint8_t(n)});
+    }
+
+    //! The partition @f$(1^n)@f$, which is the last one for #rank
+    static Partition16 last(size_t n) noexcept {
+        HPCOMBI_ASSERT(n <= 16);
+        return Partition16(Epu8(1) & (Epu8.id() < Epu8(uint8_t(n))));
+    }
+
+    //! The partitions of \p n in the order of #rank, using #next_revlex
+    static std::vector<Partition16> all(size_t n);
+};
+
+/** The cycle type of \p p, that is the partition of 16 given by the lengths
+ * of its cycles
+ * @par Algorithm: #HPCombi::eval16 of #HPCombi::Perm16::cycles_partition
+ * counts the elements of each cycle at the position of its smallest element.
+ */
+inline Partition16 cycle_type(Perm16 const &p) noexcept {
+    return HPCombi::revsorted(HPCombi::eval16(p.cycles_partition()));
+}
+
+/** Integer compositions of @f$n \leq 16@f$, that is sequences of positive
+integers of sum @f$n@f$.
+
+The parts are stored in order, padded with zeros. The compositions of
+@f$n > 0@f$ are in bijection with the subsets of @f$\{1\dots n-1\}@f$, their
+descent sets, see #descents; they are ranked in lexicographic order,
+starting with @f$(1^n)@f$ and ending with @f$(n)@f$, which is the order of
+#all.
+*/
+struct alignas(16) Composition16 : public Vect16 {
+    using vect = HPCombi::Vect16;
+
+    Composition16() = default;
+    constexpr Composition16(const Composition16 &v) = default;
+    /* implicit */ constexpr Composition16(const vect v)  // NOLINT
+        : Vect16(v) {}
+    /* implicit */ constexpr Composition16(const epu8 x)  // NOLINT
+        : Vect16(x) {}
+    Composition16(std::initializer_list<uint8_t> il) : Vect16(il) {}
+    Composition16 &operator=(const Composition16 &) = default;
+
+    //! Return whether \c *this is a well constructed object
+    bool validate() const;
+
+    //! The number of non zero parts of \c *this
+    size_t length() const noexcept {
+        return __builtin_popcount(simde_mm_movemask_epi8(v != epu8{}));
+    }
+
+    //! The partition obtained by sorting the parts of \c *this
+    Partition16 to_partition() const noexcept {
+        return HPCombi::revsorted(v);
+    }
+
+    /** The descent set of \c *this, that is the set of its partial sums
+     * but the last one
+     * @par Example:
+     * @code
+     * Composition16({2, 1, 3}).descents()
+     * @endcode
+     * Returns @verbatim {2, 3} @endverbatim
+     */
+    Subset16 descents() const noexcept;
+
+    /** The composition of \p n with descent set \p d, which must be a
+     * subset of @f$\{1\dots n-1\}@f$; inverse of #descents
+     * @par Algorithm: the differences of the consecutive entries of
+     * #HPCombi::Subset16::to_gather.
+     */
+    static Composition16 from_descents(size_t n, Subset16 d) noexcept;
+
+    //! The rank of \c *this among the compositions of the same integer
+    size_t rank() const noexcept;
+
+    /** The composition of \p n of rank \p r; inverse of #rank.
+     * @details \p r must be smaller than #count(n).
+     */
+    static Composition16 unrank(size_t n, size_t r) noexcept;
+
+    /** Replace \c *this by the next composition of the same integer in
+     * lexicographic order
+     * @returns \c false and resets \c *this to @f$(1^n)@f$ if \c *this was
+     * @f$(n)@f$, \c true otherwise.
+     */
+    bool next_lex() noexcept;
+
+    /** Replace \c *this by the next composition of the same integer in
+     * reverse lexicographic order
+     * @returns \c false and resets \c *this to @f$(n)@f$ if \c *this was
+     * @f$(1^n)@f$, \c true otherwise.
+     */
+    bool next_revlex() noexcept;
+
+    //! The number @f$2^{n-1}@f$ of compositions of \p n > 0
+    static size_t count(size_t n) noexcept {
+        HPCOMBI_ASSERT(n <= 16);
+        return n == 0 ? 1 : size_t(1) << (n - 1);
+    }
+
+    //! The compositions of \p n in the order of #rank
+    static std::vector<Composition16> all(size_t n);
+};
+
+static_assert(std::is_trivial<Partition16>(),
+              "Partition16 is not a trivial class !");
+static_assert(std::is_trivial<Composition16>(),
+              "Composition16 is not a trivial class !");
+
+}  // namespace HPCombi
+
+#include "partition16_impl.hpp"
+
+namespace std {
+
+//! This type appears in the doc because we provide a hash function for
+//! HPCombi::Partition16.
+template <> struct hash<HPCombi::Partition16> {
+    //! A hash operator for #HPCombi::Partition16
+    size_t operator()(const HPCombi::Partition16 &ar) const {
+        return HPCombi::FastHash<HPCombi::Partition16>{}(ar);
+    }
+};
+
+//! This type appears in the doc because we provide a hash function for
+//! HPCombi::Composition16.
+template <> struct hash<HPCombi::Composition16> {
+    //! A hash operator for #HPCombi::Composition16
+    size_t operator()(const HPCombi::Composition16 &ar) const {
+        return HPCombi::FastHash<HPCombi::Composition16>{}(ar);
+    }
+};
+
+}  // namespace std
+
+#endif  // HPCOMBI_PARTITION16_HPP_
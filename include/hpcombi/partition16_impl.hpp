@@ -0,0 +1,200 @@
+//****************************************************************************//
+//    Copyright (C) 2018-2024 Finn Smith <fls3@st-andrews.ac.uk>              //
+//    Copyright (C) 2018-2024 James Mitchell <jdm3@st-andrews.ac.uk>          //
+//    Copyright (C) 2018-2024 Florent Hivert <Florent.Hivert@lisn.fr>,        //
+//                                                                            //
+//  This file is part of HP-Combi <https://github.com/libsemigroups/HPCombi>  //
+//                                                                            //
+//  HP-Combi is free software: you can redistribute it and/or modify it       //
+//  under the terms of the GNU General Public License as published by the     //
+//  Free Software Foundation, either version 3 of the License, or             //
+//  (at your option) any later version.                                       //
+//                                                                            //
+//  HP-Combi is distributed in the hope that it will be useful, but WITHOUT   //
+//  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or     //
+//  FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License      //
+//  for  more details.                                                        //
+//                                                                            //
+//  You should have received a copy of the GNU General Public License along   //
+//  with HP-Combi. If not, see <https://www.gnu.org/licenses/>.               //
+//****************************************************************************//
+
+// NOLINT(build/header_guard)
+
+/** @file
+@brief implementation of partition16.hpp ; this file should not be included
+directly.
+*/
+
+namespace HPCombi {
+
+namespace detail {
+
+// The mask of the positions i with lo <= i < hi
+inline epu8 range_mask(size_t lo, size_t hi) noexcept {
+    return (Epu8.id() >= Epu8(uint8_t(lo))) & (Epu8.id() < Epu8(uint8_t(hi)));
+}
+
+// The bits of x in reverse order
+constexpr uint16_t reverse_bits16(uint16_t x) noexcept {
+    x = ((x & 0x5555) << 1) | ((x >> 1) & 0x5555);
+    x = ((x & 0x3333) << 2) | ((x >> 2) & 0x3333);
+    x = ((x & 0x0F0F) << 4) | ((x >> 4) & 0x0F0F);
+    return uint16_t((x << 8) | (x >> 8));
+}
+
+}  // namespace detail
+
+inline bool Partition16::validate() const {
+    size_t n = 0;
+    for (size_t i = 0; i < 16; i++) {
+        n += v[i];
+        if (i > 0 && v[i] > v[i - 1])
+            return false;
+    }
+    return n <= 16;
+}
+
+inline bool Partition16::dominates(Partition16 const &other) const noexcept {
+    HPCOMBI_ASSERT(sum() == other.sum());
+    return is_all_zero(HPCombi::partial_sums(other.v) >
+                       HPCombi::partial_sums(v));
+}
+
+inline bool Partition16::next_lex() noexcept {
+    size_t const n = sum(), len = length();
+    if (len <= 1) {
+        *this = last(n);
+        return false;
+    }
+    // The parts which are smaller than the previous one, but the last
+    epu8 prev = HPCombi::shifted_right(v) | (Epu8.id() == epu8{});
+    uint32_t cand = simde_mm_movemask_epi8((v < prev) &
+                                           detail::range_mask(0, len - 1));
+    size_t k = 31 - __builtin_clz(cand);
+    size_t tail = n - HPCombi::partial_sums(v)[k];
+    v = (v & detail::range_mask(0, k)) |
+        ((v + Epu8(1)) & detail::range_mask(k, k + 1)) |
+        (Epu8(1) & detail::range_mask(k + 1, k + tail));
+    return true;
+}
+
+inline bool Partition16::next_revlex() noexcept {
+    size_t const n = sum(), len = length();
+    uint32_t big = simde_mm_movemask_epi8(v > Epu8(1));
+    if (big == 0) {
+        *this = first(n);
+        return false;
+    }
+    size_t k = 31 - __builtin_clz(big);
+    // The parts after k are ones, they are redistributed with v[k] - 1
+    uint8_t part = v[k] - 1;
+    size_t rest = len - k, q = rest / part;
+    v = (v & detail::range_mask(0, k)) |
+        (Epu8(part) & detail::range_mask(k, k + q + 1)) |
+        (Epu8(uint8_t(rest % part)) & detail::range_mask(k + q + 1, k + q + 2));
+    return true;
+}
+
+inline size_t Partition16::rank() const noexcept {
+    size_t n = sum(), rank_lex = 0;
+    for (size_t i = 0; i < 16 && v[i] != 0; i++) {
+        rank_lex += detail::partition_counts[n][v[i] - 1];
+        n -= v[i];
+    }
+    return count(sum()) - 1 - rank_lex;
+}
+
+inline Partition16 Partition16::unrank(size_t n, size_t r) noexcept {
+    HPCOMBI_ASSERT(r < count(n));
+    size_t rank_lex = count(n) - 1 - r;
+    Partition16 res{};
+    for (size_t i = 0; n != 0; i++) {
+        uint8_t part = 1;
+        // The number of partitions of n whose first part is part
+        while (rank_lex >= detail::partition_counts[n - part][part]) {
+            rank_lex -= detail::partition_counts[n - part][part];
+            part++;
+        }
+        res[i] = part;
+        n -= part;
+    }
+    return res;
+}
+
+inline std::vector<Partition16> Partition16::all(size_t n) {
+    std::vector<Partition16> res;
+    res.reserve(count(n));
+    Partition16 p = first(n);
+    do {
+        res.push_back(p);
+    } while (p.next_revlex());
+    return res;
+}
+
+inline bool Composition16::validate() const {
+    size_t n = 0;
+    for (size_t i = 0; i < 16; i++) {
+        n += v[i];
+        if (i > 0 && v[i] != 0 && v[i - 1] == 0)
+            return false;
+    }
+    return n <= 16;
+}
+
+inline Subset16 Composition16::descents() const noexcept {
+    epu8 sums = HPCombi::partial_sums(v);
+    return Subset16::from_values(sums | (sums >= Epu8(sum())));
+}
+
+inline Composition16 Composition16::from_descents(size_t n,
+                                                  Subset16 d) noexcept {
+    HPCOMBI_ASSERT(n <= 16);
+    HPCOMBI_ASSERT(d.is_subset_of(Subset16::first(n) - Subset16({0})));
+    size_t k = d.size();
+    epu8 sums = simde_mm_blendv_epi8(d.to_gather(), Epu8(uint8_t(n)),
+                                     Epu8.id() == Epu8(uint8_t(k)));
+    return (sums - HPCombi::shifted_right(sums)) &
+           detail::range_mask(0, n == 0 ? 0 : k + 1);
+}
+
+inline size_t Composition16::rank() const noexcept {
+    size_t n = sum();
+    if (n <= 1)
+        return 0;
+    // The first descent is the most significant bit, and a descent makes
+    // the composition smaller
+    return count(n) - 1 -
+           (detail::reverse_bits16(descents().bits()) >> (16 - n));
+}
+
+inline Composition16 Composition16::unrank(size_t n, size_t r) noexcept {
+    HPCOMBI_ASSERT(r < count(n));
+    if (n <= 1)
+        return from_descents(n, Subset16());
+    uint16_t bits = uint16_t(count(n) - 1 - r) << (16 - n);
+    return from_descents(n, Subset16(detail::reverse_bits16(bits)));
+}
+
+inline bool Composition16::next_lex() noexcept {
+    size_t const n = sum(), r = rank();
+    bool not_last = r + 1 < count(n);
+    *this = unrank(n, not_last ? r + 1 : 0);
+    return not_last;
+}
+
+inline bool Composition16::next_revlex() noexcept {
+    size_t const n = sum(), r = rank();
+    *this = unrank(n, r != 0 ? r - 1 : count(n) - 1);
+    return r != 0;
+}
+
+inline std::vector<Composition16> Composition16::all(size_t n) {
+    std::vector<Composition16> res;
+    res.reserve(count(n));
+    for (size_t r = 0; r < count(n); r++)
+        res.push_back(unrank(n, r));
+    return res;
+}
+
+}  // namespace HPCombi
@@ -0,0 +1,140 @@
+//****************************************************************************//
+//     Copyright (C) 2016-2024 Florent Hivert <Florent.Hivert@lisn.fr>,       //
+//                                                                            //
+//  This file is part of HP-Combi <https://github.com/libsemigroups/HPCombi>  //
+//                                                                            //
+//  HP-Combi is free software: you can redistribute it and/or modify it       //
+//  under the terms of the GNU General Public License as published by the     //
+//  Free Software Foundation, either version 3 of the License, or             //
+//  (at your option) any later version.                                       //
+//                                                                            //
+//  HP-Combi is distributed in the hope that it will be useful, but WITHOUT   //
+//  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or     //
+//  FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License      //
+//  for  more details.                                                        //
+//                                                                            //
+//  You should have received a copy of the GNU General Public License along   //
+//  with HP-Combi. If not, see <https://www.gnu.org/licenses/>.               //
+//****************************************************************************//
+/** @file
+@brief declaration of HPCombi::PatternMatcher */
+
+#ifndef HPCOMBI_PATTERN_HPP_
+#define HPCOMBI_PATTERN_HPP_
+
+#include <algorithm>  // for find_if, sort, min
+#include <array>      // for array
+#include <cstddef>    // for size_t
+#include <cstdint>    // for uint8_t, uint64_t
+#include <vector>     // for vector
+
+#include "debug.hpp"     // for HPCOMBI_ASSERT
+#include "epu8.hpp"      // for epu8, permuted, sort8_perm
+#include "perm16.hpp"    // for Perm16
+#include "subset16.hpp"  // for Subset16
+
+namespace HPCombi {
+
+/** Permutation pattern containment and avoidance on #HPCombi::Perm16.
+
+A permutation @f$p@f$ of size @f$n@f$ contains a pattern @f$\pi@f$ of size
+@f$k@f$ if there is a subsequence @f$p(i_1), \dots, p(i_k)@f$ with
+@f$i_1 < \dots < i_k@f$ which is in the same relative order as @f$\pi@f$.
+Otherwise @f$p@f$ avoids @f$\pi@f$.
+
+A PatternMatcher is built once for a set of patterns of size 1 to 8 (possibly
+of different sizes) and a size @f$n \leq 16@f$; it then tests whether
+permutations of size @f$n@f$ contain at least one of the patterns.
+
+@par Algorithm:
+The @f$k@f$-subsets of @f$\{0\dots n-1\}@f$ are precomputed as gather masks,
+two subsets per #HPCombi::epu8 (one in each half). The subsequences are
+extracted with a single #HPCombi::permuted and standardized with
+#HPCombi::sort8_perm which sorts both halves at once. The result is the
+inverse of the standardization, so the inverses of the patterns are stored in
+a flat open addressing hash table keyed on the 64 bits of a half. Each test
+stops as soon as one pattern is found.
+*/
+class PatternMatcher {
+ public:
+    /** Build a matcher for \p patterns in permutations of size \p n.
+     * @details Each pattern is given by its one line notation and must be a
+     * permutation of @f$\{0\dots k-1\}@f$ with @f$1 \leq k \leq 8@f$ and
+     * @f$k \leq n@f$.
+     */
+    explicit PatternMatcher(std::vector<std::vector<uint8_t>> const &patterns,
+                            size_t n = 16);
+
+    //! The size of the permutations tested by \c *this
+    size_t size() const noexcept { return _size; }
+
+    //! The number of distinct patterns of \c *this
+    size_t nb_patterns() const noexcept;
+
+    /**
+     * @brief Whether a permutation contains one of the patterns
+     * @par Example:
+     * @code
+     * PatternMatcher m({{2, 1, 0}}, 4);
+     * m.contains(Perm16({0, 3, 2, 1}))
+     * @endcode
+     * Returns @verbatim true @endverbatim
+     * @par Algorithm:
+     * @f$\binom{n}{k}/2@f$ vectorized extractions and sorts and hash lookups
+     * for each pattern size @f$k@f$, with early exit.
+     */
+    bool contains(Perm16 p) const;
+
+    /** Same interface as \ref HPCombi::PatternMatcher::contains "contains"
+     * but with a different implementation.
+     * @par Algorithm:
+     * Reference loop over all the subsets and all the patterns with a scalar
+     * standardization of the extracted subsequence.
+     */
+    bool contains_ref(Perm16 p) const;
+
+    //! Whether a permutation avoids all the patterns
+    bool avoids(Perm16 p) const { return !contains(p); }
+
+    /** Batched version of \ref HPCombi::PatternMatcher::contains "contains".
+     * @details Returns a vector whose @f$i@f$-th entry tells whether
+     * <tt>perms[i]</tt> contains one of the patterns.
+     * @par Algorithm:
+     * The permutations are processed by blocks. In each block, the loop over
+     * subsets is outermost so that a gather mask is reused for all the
+     * permutations, and a permutation is dropped from the block as soon as
+     * a pattern is found.
+     */
+    std::vector<bool> contains_many(std::vector<Perm16> const &perms) const;
+
+    //! The permutations of \p perms which avoid all the patterns
+    std::vector<Perm16> avoiders(std::vector<Perm16> const &perms) const;
+
+ private:
+    // All the patterns of a given size
+    struct Bucket {
+        size_t pattern_size;
+        // Two subsets per vector; unused lanes are set to 0xFF by pad
+        std::vector<epu8> gathers;
+        epu8 pad;
+        // Open addressing hash table of the inverse of the patterns,
+        // empty slots are ~0
+        std::vector<uint64_t> table;
+        size_t nb_keys;
+        unsigned shift;
+        std::vector<std::vector<uint8_t>> patterns;
+
+        void insert(uint64_t key);
+        bool find(uint64_t key) const;
+        bool match(epu8 p, epu8 gather) const;
+    };
+
+    size_t _size;
+    std::vector<Bucket> _buckets;
+};
+
+}  // namespace HPCombi
+
+#include "pattern_impl.hpp"
+
+#endif  // HPCOMBI_PATTERN_HPP_
@@ -0,0 +1,184 @@
+//****************************************************************************//
+//     Copyright (C) 2016-2024 Florent Hivert <Florent.Hivert@lisn.fr>,       //
+//                                                                            //
+//  This file is part of HP-Combi <https://github.com/libsemigroups/HPCombi>  //
+//                                                                            //
+//  HP-Combi is free software: you can redistribute it and/or modify it       //
+//  under the terms of the GNU General Public License as published by the     //
+//  Free Software Foundation, either version 3 of the License, or             //
+//  (at your option) any later version.                                       //
+//                                                                            //
+//  HP-Combi is distributed in the hope that it will be useful, but WITHOUT   //
+//  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or     //
+//  FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License      //
+//  for  more details.                                                        //
+//                                                                            //
+//  You should have received a copy of the GNU General Public License along   //
+//  with HP-Combi. If not, see <https://www.gnu.org/licenses/>.               //
+//****************************************************************************//
+
+// NOLINT(build/header_guard)
+
+/** @file
+@brief implementation of pattern.hpp ; this file should not be included
+directly.
+*/
+
+namespace HPCombi {
+
+inline PatternMatcher::PatternMatcher(
+    std::vector<std::vector<uint8_t>> const &patterns, size_t n)
+    : _size(n), _buckets() {
+    HPCOMBI_ASSERT(n <= 16);
+    for (auto const &patt : patterns) {
+        size_t k = patt.size();
+        HPCOMBI_ASSERT(1 <= k && k <= 8 && k <= n);
+        auto it = std::find_if(
+            _buckets.begin(), _buckets.end(),
+            [k](Bucket const &b) { return b.pattern_size == k; });
+        if (it == _buckets.end()) {
+            Bucket b{k, {}, Epu8(0), {}, 0, 0, {}};
+            for (size_t i = 8; i < 16; i++)
+                b.pad[i] = b.pad[i - 8] = (i - 8 < k) ? 0 : 0xFF;
+            std::vector<epu8> subsets;
+            Subset16::for_each_k_subset(n, k, [&subsets](Subset16 s) {
+                subsets.push_back(s.to_gather());
+            });
+            if (subsets.size() % 2 == 1)
+                subsets.push_back(subsets.back());
+            for (size_t i = 0; i < subsets.size(); i += 2)
+                b.gathers.push_back(
+                    simde_mm_unpacklo_epi64(subsets[i], subsets[i + 1]));
+            _buckets.push_back(std::move(b));
+            it = std::prev(_buckets.end());
+        }
+        uint64_t key = 0;
+        for (size_t i = 0; i < k; i++) {
+            HPCOMBI_ASSERT(patt[i] < k);
+            key |= uint64_t(i) << (8 * patt[i]);
+        }
+        if (!it->find(key)) {
+            it->insert(key);
+            it->patterns.push_back(patt);
+        }
+    }
+    // Fewer subsets first for early exit
+    std::sort(_buckets.begin(), _buckets.end(),
+              [](Bucket const &a, Bucket const &b) {
+                  return a.gathers.size() < b.gathers.size();
+              });
+}
+
+inline size_t PatternMatcher::nb_patterns() const noexcept {
+    size_t res = 0;
+    for (auto const &b : _buckets)
+        res += b.patterns.size();
+    return res;
+}
+
+inline void PatternMatcher::Bucket::insert(uint64_t key) {
+    constexpr uint64_t empty = ~uint64_t(0);
+    if (2 * (nb_keys + 1) > table.size()) {
+        std::vector<uint64_t> old(table.empty() ? 8 : 2 * table.size(), empty);
+        std::swap(old, table);
+        shift = 64 - __builtin_ctzl(table.size());
+        nb_keys = 0;
+        for (auto k : old)
+            if (k != empty)
+                insert(k);
+    }
+    size_t i = (key * prime) >> shift;
+    while (table[i] != empty)
+        i = (i + 1) & (table.size() - 1);
+    table[i] = key;
+    nb_keys++;
+}
+
+inline bool PatternMatcher::Bucket::find(uint64_t key) const {
+    constexpr uint64_t empty = ~uint64_t(0);
+    if (table.empty())
+        return false;
+    for (size_t i = (key * prime) >> shift; table[i] != empty;
+         i = (i + 1) & (table.size() - 1))
+        if (table[i] == key)
+            return true;
+    return false;
+}
+
+inline bool PatternMatcher::Bucket::match(epu8 p, epu8 gather) const {
+    epu8 sub = permuted(p, gather) | pad;
+    epu8 std_inv = sort8_perm(sub) & (Epu8(7) & ~pad);
+    return find(simde_mm_extract_epi64(std_inv, 0)) ||
+           find(simde_mm_extract_epi64(std_inv, 1));
+}
+
+inline bool PatternMatcher::contains(Perm16 p) const {
+    for (auto const &b : _buckets)
+        for (auto g : b.gathers)
+            if (b.match(p.v, g))
+                return true;
+    return false;
+}
+
+inline bool PatternMatcher::contains_ref(Perm16 p) const {
+    for (auto const &b : _buckets) {
+        size_t k = b.pattern_size;
+        bool found = false;
+        Subset16::for_each_k_subset(_size, k, [&](Subset16 s) {
+            std::vector<uint8_t> sub, stdz(k, 0);
+            for (auto i : s)
+                sub.push_back(p[i]);
+            for (size_t i = 0; i < k; i++)
+                for (size_t j = 0; j < k; j++)
+                    if (sub[j] < sub[i])
+                        stdz[i]++;
+            for (auto const &patt : b.patterns)
+                if (patt == stdz)
+                    found = true;
+        });
+        if (found)
+            return true;
+    }
+    return false;
+}
+
+inline std::vector<bool>
+PatternMatcher::contains_many(std::vector<Perm16> const &perms) const {
+    constexpr size_t block_size = 64;
+    std::vector<bool> res(perms.size(), false);
+    std::array<size_t, block_size> alive;
+    for (size_t start = 0; start < perms.size(); start += block_size) {
+        size_t nb = std::min(block_size, perms.size() - start);
+        for (size_t i = 0; i < nb; i++)
+            alive[i] = start + i;
+        for (auto const &b : _buckets) {
+            for (auto g : b.gathers) {
+                for (size_t i = 0; i < nb;) {
+                    if (b.match(perms[alive[i]].v, g)) {
+                        res[alive[i]] = true;
+                        alive[i] = alive[--nb];
+                    } else {
+                        i++;
+                    }
+                }
+                if (nb == 0)
+                    break;
+            }
+            if (nb == 0)
+                break;
+        }
+    }
+    return res;
+}
+
+inline std::vector<Perm16>
+PatternMatcher::avoiders(std::vector<Perm16> const &perms) const {
+    std::vector<bool> cont = contains_many(perms);
+    std::vector<Perm16> res;
+    for (size_t i = 0; i < perms.size(); i++)
+        if (!cont[i])
+            res.push_back(perms[i]);
+    return res;
+}
+
+}  // namespace HPCombi
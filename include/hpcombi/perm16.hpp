@@ -28,17 +28,22 @@
 #ifndef HPCOMBI_PERM16_HPP_
 #define HPCOMBI_PERM16_HPP_
 
+#include <algorithm>         // for sort, reverse, min
+#include <array>             // for array
 #include <cstddef>           // for size_t
 #include <cstdint>           // for uint8_t, uint64_t, uint32_t
 #include <initializer_list>  // for initializer_list
 #include <memory>            // for hash
 #include <type_traits>       // for is_trivial
+#include <unordered_set>     // for unordered_set
 #include <vector>            // for vector
 
 #include "epu8.hpp"    // for epu8, permuted, etc
 #include "power.hpp"   // for pow
+#include "random.hpp"  // for random_stream
 #include "vect16.hpp"  // for hash, is_partial_permutation
 
+#include "simde/x86/avx2.h"
 #include "simde/x86/sse4.1.h"
 #include "simde/x86/sse4.2.h"
 
@@ -122,6 +127,14 @@ struct alignas(16) PTransf16 : public Vect16 {
     uint8_t largest_moved_point() const;
     /** Returns the number of fix points of \c *this */
     uint8_t nb_fix_points() const;
+
+    /** Returns whether \c *this is idempotent, that is equal to its square
+     * @par Algorithm: a single #HPCombi::permuted, without the general
+     * product */
+    bool is_idempotent() const;
+    /** Returns whether \c *this is idempotent
+     * @par Algorithm: checks that all the points of the image are fixed */
+    bool is_idempotent_ref() const;
 };
 
 /** Full transformation of @f$\{0\dots 15\}@f$:
@@ -148,12 +161,34 @@ struct Transf16 : public PTransf16 {
         return HPCombi::permuted(v, p.v);
     }
 
+    /** A uniformly random transformation of @f$\{0\dots n-1\}@f$, fixing
+     * the points larger than @f$n@f$
+     * @par Algorithm: #HPCombi::random_epu8 blended with the identity.
+     */
+    static Transf16 random(uint64_t n = 16);
+    /** A vector of \p count random transformations of
+     * @f$\{0\dots n-1\}@f$; see \ref HPCombi::Transf16::random "random" */
+    static std::vector<Transf16> random_many(size_t count, uint64_t n = 16);
+
+    //! Returns which of \p n transformations are idempotent
+    //!
+    //! Sets the bit @f$j@f$ of the bitmap \p out, that is the bit
+    //! @f$j \bmod 64@f$ of <tt>out[j / 64]</tt>, if <tt>xs[j]</tt> is
+    //! idempotent; \p out must hold @f$\lceil n/64 \rceil@f$ words, which
+    //! are overwritten. Tests two transformations per iteration in a 256
+    //! bits register.
+    static void is_idempotent_many(Transf16 const *xs, size_t n,
+                                   uint64_t *out) noexcept;
+
     //! Construct a transformation from its 64 bits compressed.
     explicit Transf16(uint64_t compressed);
     //! The 64 bit compressed form of a transformation.
     explicit operator uint64_t() const;
 };
 
+//! The hash key of a #HPCombi::Transf16 is its 64 bit compressed form
+inline uint64_t hash_key(Transf16 const &t) { return uint64_t(t); }
+
 /** Partial permutation of @f$\{0\dots 15\}@f$; see also HPCombi::Perm16;
 partial means it might not be defined everywhere (but where it's defined, it's
 injective). Undefined images are encoded as 0xFF. */
@@ -209,8 +244,179 @@ struct PPerm16 : public PTransf16 {
     PPerm16 inverse_find() const;
 #endif
 
+    /** Same as \ref HPCombi::PPerm16::inverse_ref "inverse_ref" but with a
+     * different algorithm.
+     *  @par Algorithm:
+     *  @f$O(n)@f$ vector operations: the vector is cycled 16 times and the
+     *  entries which match the identity are blended into the result. Only
+     *  needs shuffle, comparison and blend so it is fast without SSE4.2
+     *  (for example on ARM NEON).
+     */
+    PPerm16 inverse_cycle() const;
+
+    /** Invert two partial permutations at once, in place.
+     *  @par Algorithm:
+     *  Same as \ref HPCombi::PPerm16::inverse_cycle "inverse_cycle" on the
+     *  two halves of a 256 bits AVX2 vector; on machines without AVX2 this
+     *  is emulated by two 128 bits operations.
+     */
+    static void inverse2(PPerm16 &a, PPerm16 &b);
+
+    /**
+     * @brief The inverse of a partial permutation
+     * @details See \ref HPCombi::PPerm16::inverse_ref "inverse_ref" for the
+     * definition.
+     *  @par Algorithm: aliased to #inverse_cycle which is faster than
+     *  #inverse_find even when SSE4.2 is available.
+     */
+    PPerm16 inverse() const { return inverse_cycle(); }
+
     PPerm16 right_one() const { return PTransf16::right_one(); }
     PPerm16 left_one() const { return PTransf16::left_one(); }
+
+    /**
+     * @brief Compare two partial permutations for the natural partial order
+     * @details @f$f \leq g@f$ if and only if @f$f@f$ is the restriction of
+     * @f$g@f$ to the domain of @f$f@f$.
+     * @par Example:
+     * @code
+     * PPerm16 f{0xFF,2,0xFF,3}, g{0,2,1,3};
+     * f.natural_leq(g)
+     * @endcode
+     * Returns @verbatim true @endverbatim
+     * @par Algorithm:
+     * @f$O(1)@f$ using #domain_mask and vector comparison
+     */
+    bool natural_leq(PPerm16 other) const {
+        return is_all_zero((v != other.v) & domain_mask());
+    }
+    /** Same interface as \ref HPCombi::PPerm16::natural_leq "natural_leq"
+     * but with a different implementation.
+     * @par Algorithm:
+     * Reference @f$O(n)@f$ loop
+     */
+    bool natural_leq_ref(PPerm16 other) const;
+
+    /** The restriction of \c *this to the domain given by the bit mask
+     * \p dom.
+     * @par Algorithm:
+     * @f$O(1)@f$ using #HPCombi::mask_from_bitset
+     */
+    PPerm16 restricted(uint32_t dom) const {
+        return v | ~mask_from_bitset(dom);
+    }
+    /** Same interface as \ref HPCombi::PPerm16::restricted "restricted"
+     * but with a different implementation.
+     * @par Algorithm:
+     * Reference @f$O(n)@f$ loop
+     */
+    PPerm16 restricted_ref(uint32_t dom) const;
+
+    /** The corestriction of \c *this to the image given by the bit mask
+     * \p img, that is the restriction to the preimage of \p img.
+     * @par Algorithm:
+     * @f$O(1)@f$ using a shuffle of #HPCombi::mask_from_bitset
+     */
+    PPerm16 corestricted(uint32_t img) const {
+        return v | ~HPCombi::permuted(mask_from_bitset(img), v);
+    }
+
+    /**
+     * @brief The meet of two partial permutations for the natural order
+     * @details The meet is the restriction of both partial permutations to
+     * the set of points where they agree.
+     * @par Example:
+     * @code
+     * PPerm16 f{0,1,2,3}, g{0,2,1,3};
+     * f.meet(g)
+     * @endcode
+     * Returns @verbatim {0,0xFF,0xFF,3,...} @endverbatim
+     * @par Algorithm:
+     * @f$O(1)@f$ using vector comparison
+     */
+    PPerm16 meet(PPerm16 other) const { return v | (v != other.v); }
+    /** Same interface as \ref HPCombi::PPerm16::meet "meet"
+     * but with a different implementation.
+     * @par Algorithm:
+     * Reference @f$O(n)@f$ loop
+     */
+    PPerm16 meet_ref(PPerm16 other) const;
+
+    /**
+     * @brief Whether two partial permutations are compatible
+     * @details Two partial permutations are compatible if the union of
+     * their graphs is a partial permutation, that is if they have a join
+     * for the natural partial order.
+     * @par Algorithm:
+     * @f$O(1)@f$ using #domain_mask and #image_bitset on the parts where
+     * the two partial permutations differ
+     */
+    bool is_compatible(PPerm16 other) const;
+    /** Same interface as \ref HPCombi::PPerm16::is_compatible
+     * "is_compatible" but with a different implementation.
+     * @par Algorithm:
+     * Reference @f$O(n^2)@f$ loop
+     */
+    bool is_compatible_ref(PPerm16 other) const;
+
+    /**
+     * @brief The join of two compatible partial permutations for the
+     * natural order
+     * @details The graph of the join is the union of the graphs. The result
+     * is undefined if \c *this and \p other are not compatible.
+     * @par Example:
+     * @code
+     * PPerm16 f{0,0xFF,0xFF,3}, g{0xFF,2,0xFF,3};
+     * f.join(g)
+     * @endcode
+     * Returns @verbatim {0,2,0xFF,3,...} @endverbatim
+     * @par Algorithm:
+     * @f$O(1)@f$ using a vector minimum since undefined points are 0xFF
+     */
+    PPerm16 join(PPerm16 other) const {
+        HPCOMBI_ASSERT(is_compatible(other));
+        return HPCombi::min(v, other.v);
+    }
+
+    /**
+     * @brief The product of two partial permutations tracking domain and
+     * image
+     * @details Returns <tt>*this * other</tt> and sets \p dom and \p img to
+     * the bit masks of its domain and image. \p inv and \p other_inv must be
+     * the inverses of \c *this and \p other; on return \p inv holds the
+     * inverse of the product so that products can be chained without ever
+     * computing an image mask.
+     * @par Algorithm:
+     * Two products and two movemasks, using @f$(fg)^{-1} = g^{-1}f^{-1}@f$
+     * and the fact that the image of a partial permutation is the domain of
+     * its inverse.
+     */
+    PPerm16 mult_track(PPerm16 other, PPerm16 other_inv, PPerm16 &inv,
+                       uint32_t &dom, uint32_t &img) const {
+        PPerm16 res = *this * other;
+        inv = other_inv * inv;
+        dom = res.domain_bitset();
+        img = inv.domain_bitset();
+        return res;
+    }
+
+    /** Batched version of \ref HPCombi::PPerm16::natural_leq "natural_leq".
+     * @details Returns a vector whose @f$i@f$-th entry tells whether
+     * \c *this is smaller than <tt>others[i]</tt>.
+     */
+    std::vector<bool>
+    natural_leq_many(std::vector<PPerm16> const &others) const;
+
+    /** Batched version of \ref HPCombi::PPerm16::meet "meet": the meets of
+     * \c *this with all the elements of \p others.
+     */
+    std::vector<PPerm16> meet_many(std::vector<PPerm16> const &others) const;
+
+    /** Batched version of \ref HPCombi::PPerm16::restricted "restricted":
+     * the restrictions of all the elements of \p elems to \p dom.
+     */
+    static std::vector<PPerm16>
+    restricted_many(std::vector<PPerm16> const &elems, uint32_t dom);
 };
 
 /** Permutations of @f$\{0\dots 15\}@f$:
@@ -307,8 +513,18 @@ struct Perm16 : public Transf16 /* public PPerm : diamond problem */ {
 
     /** The elementary transposition exchanging @f$i@f$ and @f$i+1@f$ */
     static Perm16 elementary_transposition(uint64_t i);
-    /** A random permutation of size @f$n@f$*/
+    /** A random permutation of size @f$n@f$
+     * @details Uniform up to a bias less than @f$2^{-19}@f$ on the
+     * probabilities.
+     * @par Algorithm: Fisher-Yates shuffle where all the random indices are
+     * extracted from a single 64 bits draw of #HPCombi::random_stream, by
+     * successive multiplications by the mixed radices
+     * @f$n, n-1, \dots, 2@f$.
+     */
     static Perm16 random(uint64_t n = 16);
+    /** A vector of \p count random permutations of size @f$n@f$; see
+     * \ref HPCombi::Perm16::random "random" */
+    static std::vector<Perm16> random_many(size_t count, uint64_t n = 16);
     /** The \c r -th permutation of size \c n for the
      *  Steinhaus–Johnson–Trotter order.
      */
@@ -466,8 +682,205 @@ struct Perm16 : public Transf16 /* public PPerm : diamond problem */ {
      *  Reference @f$O(n)@f$ with vectorized test of inclusion
      */
     bool left_weak_leq_length(Perm16 other) const;
+
+    /**
+     * @brief Compare two permutations for the right weak order
+     * @details The right weak order compares the inversions by values, that
+     * is @f$x \leq y@f$ if and only if @f$x^{-1} \leq y^{-1}@f$ for the left
+     * weak order.
+     * @par Example:
+     * @code
+     * Perm16 x{1,0,2,3}, y{1,2,0,3};
+     * x.right_weak_leq(y)
+     * @endcode
+     * Returns @verbatim true @endverbatim
+     *  @par Algorithm:
+     *  @f$O(n)@f$ algorithm using inverse and #left_weak_leq
+     */
+    bool right_weak_leq(Perm16 other) const {
+        return inverse().left_weak_leq(other.inverse());
+    }
+
+    /** Same interface as \ref HPCombi::Perm16::right_weak_leq "right_weak_leq"
+     * but with a different implementation.
+     *  @par Algorithm:
+     *  Reference @f$O(n^2)@f$ testing inclusion of inversions by values
+     *  one by one
+     */
+    bool right_weak_leq_ref(Perm16 other) const;
+
+    /**
+     * @brief The meet (greatest lower bound) of two permutations for the left
+     * weak order
+     * @par Example:
+     * @code
+     * Perm16 x{1,0,2,3}, y{0,2,1,3};
+     * x.left_weak_meet(y)
+     * @endcode
+     * Returns @verbatim {0,1,2,3,...} @endverbatim
+     *  @par Algorithm:
+     *  Duality with #left_weak_join using the maximal permutation
+     */
+    Perm16 left_weak_meet(Perm16 other) const;
+
+    /** Same interface as \ref HPCombi::Perm16::left_weak_meet "left_weak_meet"
+     * but with a different implementation.
+     *  @par Algorithm:
+     *  Reference @f$O(n^3)@f$: the non inversions of the meet are the
+     *  transitive closure of the union of the non inversions, computed on a
+     *  boolean matrix with Warshall's algorithm
+     */
+    Perm16 left_weak_meet_ref(Perm16 other) const;
+
+    /**
+     * @brief The join (least upper bound) of two permutations for the left
+     * weak order
+     * @par Example:
+     * @code
+     * Perm16 x{1,0,2,3}, y{0,2,1,3};
+     * x.left_weak_join(y)
+     * @endcode
+     * Returns @verbatim {2,1,0,3,...} @endverbatim
+     *  @par Algorithm:
+     *  The inversions of the join are the transitive closure of the union of
+     *  the inversions. They are computed as a vectorized bit matrix and closed
+     *  with Warshall's algorithm in @f$O(n^2)@f$ word operations.
+     */
+    Perm16 left_weak_join(Perm16 other) const;
+
+    /** Same interface as \ref HPCombi::Perm16::left_weak_join "left_weak_join"
+     * but with a different implementation.
+     *  @par Algorithm:
+     *  Reference @f$O(n^3)@f$: transitive closure of the union of the
+     *  inversions on a boolean matrix with Warshall's algorithm
+     */
+    Perm16 left_weak_join_ref(Perm16 other) const;
+
+    /** The meet of two permutations for the right weak order.
+     * See \ref HPCombi::Perm16::left_weak_meet "left_weak_meet".
+     */
+    Perm16 right_weak_meet(Perm16 other) const {
+        return inverse().left_weak_meet(other.inverse()).inverse();
+    }
+    /** The join of two permutations for the right weak order.
+     * See \ref HPCombi::Perm16::left_weak_join "left_weak_join".
+     */
+    Perm16 right_weak_join(Perm16 other) const {
+        return inverse().left_weak_join(other.inverse()).inverse();
+    }
+
+    /**
+     * @brief Compare two permutations for the Bruhat order
+     * @details @f$x \leq y@f$ if and only if, for all @f$i, j@f$, the number
+     * of @f$a \leq i@f$ such that @f$x(a) \geq j@f$ is at most the same
+     * number for @f$y@f$ (rank matrices criterion).
+     * @par Example:
+     * @code
+     * Perm16 x{1,0,2,3}, y{2,1,0,3};
+     * x.bruhat_leq(y)
+     * @endcode
+     * Returns @verbatim true @endverbatim
+     *  @par Algorithm:
+     *  @f$O(n)@f$ vector operations: a fast rejection with #partial_max,
+     *  then the rows of the rank matrices are computed with #partial_sums
+     */
+    bool bruhat_leq(Perm16 other) const;
+
+    /** Same interface as \ref HPCombi::Perm16::bruhat_leq "bruhat_leq"
+     * but with a different implementation.
+     *  @par Algorithm:
+     *  Reference @f$O(n^2 \log n)@f$ tableau criterion: compare the sorted
+     *  prefixes of the two permutations
+     */
+    bool bruhat_leq_ref(Perm16 other) const;
+
+    /**
+     * @brief The descent set of a permutation
+     * @details
+     * @returns a bit mask whose @f$i@f$-th bit is set if @f$x(i) > x(i+1)@f$
+     * @par Example:
+     * @code
+     * Perm16 x {0,3,2,4,1,5,6,7,8,9,10,11,12,13,14,15};
+     * x.descents_bitset()
+     * @endcode
+     * Returns @verbatim 0b1010 @endverbatim
+     *  @par Algorithm:
+     *  @f$O(1)@f$ using vector shift, comparison and movemask
+     */
+    uint32_t descents_bitset() const {
+        return simde_mm_movemask_epi8(v < shifted_right(v)) >> 1;
+    }
+
+    /** Same interface as \ref HPCombi::Perm16::descents_bitset
+     * "descents_bitset", with a different implementation.
+     *  @par Algorithm:
+     *  Reference @f$O(n)@f$ using a loop
+     */
+    uint32_t descents_bitset_ref() const;
+
+    /**
+     * @brief A reduced word of a permutation
+     * @details
+     * @returns a vector @f$w@f$ of length #length such that \c *this is the
+     * product of the elementary transpositions
+     * <tt>elementary_transposition(w[0]) * ... *
+     * elementary_transposition(w[k-1])</tt>
+     * @par Example:
+     * @code
+     * Perm16 x {0,2,1,3,...};
+     * x.reduced_word()
+     * @endcode
+     * Returns @verbatim {1} @endverbatim
+     *  @par Algorithm:
+     *  Repeatedly remove the first descent found with #descents_bitset,
+     *  @f$O(\ell)@f$ vector operations where @f$\ell@f$ is the length
+     */
+    std::vector<uint8_t> reduced_word() const;
+
+    /** Same interface as \ref HPCombi::Perm16::reduced_word "reduced_word",
+     * with a different implementation.
+     *  @par Algorithm:
+     *  Reference @f$O(n^2)@f$ bubble sort on an array
+     */
+    std::vector<uint8_t> reduced_word_ref() const;
 };
 
+/** The conjugate @f$a^{-1}ba@f$ of \p b by \p a */
+inline Perm16 conjugate(Perm16 a, Perm16 b) { return a.inverse() * b * a; }
+
+/**
+ * @brief The commutator @f$[a, b] = a^{-1}b^{-1}ab@f$
+ * @par Algorithm:
+ * A single inverse using @f$[a, b] = (ba)^{-1}(ab)@f$
+ */
+inline Perm16 commutator(Perm16 a, Perm16 b) {
+    return (b * a).inverse() * (a * b);
+}
+
+/**
+ * @brief The conjugates @f$g^{-1}xg@f$ of all the elements @f$x@f$ of \p elems
+ * @par Algorithm:
+ * The inverse of \p g is computed only once, then two shuffles per element.
+ */
+inline std::vector<Perm16> conjugate_all(std::vector<Perm16> const &elems,
+                                         Perm16 g);
+
+/**
+ * @brief Representatives of the right cosets of a subgroup
+ * @details Returns one representative for each right coset @f$Hx@f$ of the
+ * subgroup @f$H@f$ generated by \p subgens in the group @f$G@f$ generated by
+ * \p gens. Each representative is the lexicographically smallest element of
+ * its coset, the first one is the identity.
+ * @par Algorithm:
+ * The elements of @f$H@f$ are listed first, so it should be small. Then the
+ * cosets are enumerated by a breadth first search multiplying by the
+ * generators of @f$G@f$ on the right; each new coset costs @f$|H|@f$ shuffles
+ * and vector comparisons to compute its representative.
+ */
+inline std::vector<Perm16>
+right_coset_reps(std::vector<Perm16> const &gens,
+                 std::vector<Perm16> const &subgens);
+
 ///////////////////////////////////////////////////////////////////////////////
 /// Memory layout concepts check  /////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////
@@ -489,7 +902,7 @@ namespace std {
 template <> struct hash<HPCombi::PTransf16> {
     //! A hash operator for #HPCombi::PTransf16
     size_t operator()(const HPCombi::PTransf16 &ar) const {
-        return std::hash<HPCombi::epu8>{}(ar.v);
+        return HPCombi::FastHash<HPCombi::PTransf16>{}(ar);
     }
 };
 
@@ -498,7 +911,7 @@ template <> struct hash<HPCombi::PTransf16> {
 template <> struct hash<HPCombi::Transf16> {
     //! A hash operator for #HPCombi::Transf16
     size_t operator()(const HPCombi::Transf16 &ar) const {
-        return uint64_t(ar);
+        return HPCombi::FastHash<HPCombi::Transf16>{}(ar);
     }
 };
 
@@ -507,7 +920,7 @@ template <> struct hash<HPCombi::Transf16> {
 template <> struct hash<HPCombi::PPerm16> {
     //! A hash operator for #HPCombi::PPerm16
     size_t operator()(const HPCombi::PPerm16 &ar) const {
-        return std::hash<HPCombi::epu8>{}(ar.v);
+        return HPCombi::FastHash<HPCombi::PPerm16>{}(ar);
     }
 };
 
@@ -515,7 +928,9 @@ template <> struct hash<HPCombi::PPerm16> {
 //! HPCombi::Perm16.
 template <> struct hash<HPCombi::Perm16> {
     //! A hash operator for #HPCombi::Perm16
-    size_t operator()(const HPCombi::Perm16 &ar) const { return uint64_t(ar); }
+    size_t operator()(const HPCombi::Perm16 &ar) const {
+        return HPCombi::FastHash<HPCombi::Perm16>{}(ar);
+    }
 };
 
 }  // namespace std
@@ -121,6 +121,13 @@ inline uint8_t PTransf16::nb_fix_points() const {
     return __builtin_popcountl(fix_points_bitset());
 }
 
+inline bool PTransf16::is_idempotent() const {
+    return equal(HPCombi::permuted(v, v) | (v == Epu8(0xFF)), v);
+}
+inline bool PTransf16::is_idempotent_ref() const {
+    return is_all_zero(image_mask() & fix_points_mask(true));
+}
+
 inline static constexpr uint8_t hilo_exchng_fun(uint8_t i) {
     return i < 8 ? i + 8 : i - 8;
 }
@@ -142,6 +149,28 @@ inline Transf16::operator uint64_t() const {
     return simde_mm_extract_epi64(res, 0);
 }
 
+inline void Transf16::is_idempotent_many(Transf16 const *xs, size_t n,
+                                         uint64_t *out) noexcept {
+    static_assert(sizeof(Transf16) == 16, "Transf16 is not packed");
+    for (size_t w = 0; 64 * w < n; w++) {
+        size_t const end = std::min(n, 64 * w + 64);
+        uint64_t word = 0;
+        size_t j = 64 * w;
+        for (; j + 2 <= end; j += 2) {
+            simde__m256i x = simde_mm256_loadu_si256(
+                reinterpret_cast<simde__m256i const *>(xs + j));
+            uint32_t eq = simde_mm256_movemask_epi8(
+                simde_mm256_cmpeq_epi8(simde_mm256_shuffle_epi8(x, x), x));
+            word |= (uint64_t((eq & 0xFFFF) == 0xFFFF) |
+                     uint64_t((eq >> 16) == 0xFFFF) << 1)
+                    << (j % 64);
+        }
+        if (j < end)
+            word |= uint64_t(xs[j].is_idempotent()) << (j % 64);
+        out[w] = word;
+    }
+}
+
 inline PPerm16 PPerm16::inverse_ref() const {
     epu8 res = Epu8(0xFF);
     for (size_t i = 0; i < 16; ++i)
@@ -157,14 +186,146 @@ inline PPerm16 PPerm16::inverse_find() const {
 }
 #endif
 
-inline Perm16 Perm16::random(uint64_t n) {
-    static std::random_device rd;
-    static std::mt19937 g(rd());
+inline PPerm16 PPerm16::inverse_cycle() const {
+    epu8 res = Epu8(0xFF), vcyc = v, idx = Epu8.id();
+    for (int i = 0; i < 16; i++) {
+        // idx[j] is the position of vcyc[j] in v
+        res = simde_mm_blendv_epi8(res, idx, vcyc == Epu8.id());
+        vcyc = HPCombi::permuted(vcyc, Epu8.left_cycle());
+        idx = HPCombi::permuted(idx, Epu8.left_cycle());
+    }
+    return res;
+}
+
+inline void PPerm16::inverse2(PPerm16 &a, PPerm16 &b) {
+    const simde__m256i id = simde_mm256_set_m128i(Epu8.id(), Epu8.id());
+    const simde__m256i cycle =
+        simde_mm256_set_m128i(Epu8.left_cycle(), Epu8.left_cycle());
+    simde__m256i res = simde_mm256_set1_epi8(-1), idx = id;
+    simde__m256i vcyc = simde_mm256_set_m128i(b.v, a.v);
+    for (int i = 0; i < 16; i++) {
+        res = simde_mm256_blendv_epi8(res, idx,
+                                      simde_mm256_cmpeq_epi8(vcyc, id));
+        vcyc = simde_mm256_shuffle_epi8(vcyc, cycle);
+        idx = simde_mm256_shuffle_epi8(idx, cycle);
+    }
+    a.v = simde_mm256_castsi256_si128(res);
+    b.v = simde_mm256_extracti128_si256(res, 1);
+}
+
+inline bool PPerm16::natural_leq_ref(PPerm16 other) const {
+    for (size_t i = 0; i < 16; i++)
+        if (v[i] != 0xFF && v[i] != other[i])
+            return false;
+    return true;
+}
+
+inline PPerm16 PPerm16::restricted_ref(uint32_t dom) const {
+    epu8 res = v;
+    for (size_t i = 0; i < 16; i++)
+        if (((dom >> i) & 1) == 0)
+            res[i] = 0xFF;
+    return res;
+}
+
+inline PPerm16 PPerm16::meet_ref(PPerm16 other) const {
+    epu8 res = Epu8(0xFF);
+    for (size_t i = 0; i < 16; i++)
+        if (v[i] == other[i])
+            res[i] = v[i];
+    return res;
+}
+
+inline bool PPerm16::is_compatible(PPerm16 other) const {
+    epu8 eq = (v == other.v);
+    // The parts where the two partial permutations differ
+    PTransf16 f = v | eq, g = other.v | eq;
+    return is_all_zero(f.domain_mask() & g.domain_mask()) &&
+           (f.image_bitset() & g.image_bitset()) == 0;
+}
+
+inline bool PPerm16::is_compatible_ref(PPerm16 other) const {
+    for (size_t i = 0; i < 16; i++) {
+        if (v[i] == 0xFF)
+            continue;
+        for (size_t j = 0; j < 16; j++) {
+            if (other[j] == 0xFF)
+                continue;
+            if ((i == j) != (v[i] == other[j]))
+                return false;
+        }
+    }
+    return true;
+}
+
+inline std::vector<bool>
+PPerm16::natural_leq_many(std::vector<PPerm16> const &others) const {
+    std::vector<bool> res(others.size());
+    epu8 dom = domain_mask();
+    for (size_t i = 0; i < others.size(); i++)
+        res[i] = is_all_zero((v != others[i].v) & dom);
+    return res;
+}
+
+inline std::vector<PPerm16>
+PPerm16::meet_many(std::vector<PPerm16> const &others) const {
+    std::vector<PPerm16> res(others.size());
+    for (size_t i = 0; i < others.size(); i++)
+        res[i] = meet(others[i]);
+    return res;
+}
+
+inline std::vector<PPerm16>
+PPerm16::restricted_many(std::vector<PPerm16> const &elems, uint32_t dom) {
+    std::vector<PPerm16> res(elems.size());
+    epu8 undef = ~mask_from_bitset(dom);
+    for (size_t i = 0; i < elems.size(); i++)
+        res[i] = elems[i].v | undef;
+    return res;
+}
+
+namespace detail {
+
+// Fisher-Yates shuffle of the n first entries of ar, where the indices are
+// the successive digits of r in the mixed radix n, n-1, ..., 2. As
+// 16! < 2^45, about 19 bits of r are left unused at the end.
+inline void shuffle_mixed_radix(Perm16::array &ar, uint64_t n, uint64_t r) {
+    for (uint64_t i = n; i > 1; i--) {
+        unsigned __int128 prod = static_cast<unsigned __int128>(r) * i;
+        std::swap(ar[i - 1], ar[uint64_t(prod >> 64)]);
+        r = uint64_t(prod);
+    }
+}
 
+}  // namespace detail
+
+inline Perm16 Perm16::random(uint64_t n) {
+    HPCOMBI_ASSERT(n <= 16);
     Perm16 res = one();
-    auto ar = res.as_array();
+    detail::shuffle_mixed_radix(res.as_array(), n, random_stream()());
+    return res;
+}
 
-    std::shuffle(ar.begin(), ar.begin() + n, g);
+inline std::vector<Perm16> Perm16::random_many(size_t count, uint64_t n) {
+    HPCOMBI_ASSERT(n <= 16);
+    RandomStream &gen = random_stream();
+    std::vector<Perm16> res(count, one());
+    for (auto &p : res)
+        detail::shuffle_mixed_radix(p.as_array(), n, gen());
+    return res;
+}
+
+inline Transf16 Transf16::random(uint64_t n) {
+    HPCOMBI_ASSERT(n <= 16);
+    return simde_mm_blendv_epi8(Epu8.id(), random_epu8(n),
+                                Epu8.id() < Epu8(uint8_t(n)));
+}
+
+inline std::vector<Transf16> Transf16::random_many(size_t count, uint64_t n) {
+    std::vector<Transf16> res;
+    res.reserve(count);
+    for (size_t i = 0; i < count; i++)
+        res.push_back(random(n));
     return res;
 }
 
@@ -243,6 +404,21 @@ template <> struct Monoid<Perm16> {
     static Perm16 prod(Perm16 a, Perm16 b) { return a * b; }
 };
 
+template <> struct Monoid<PTransf16> {
+    static const PTransf16 one() { return PTransf16::one(); }
+    static PTransf16 prod(PTransf16 a, PTransf16 b) { return a * b; }
+};
+
+template <> struct Monoid<Transf16> {
+    static const Transf16 one() { return Transf16::one(); }
+    static Transf16 prod(Transf16 a, Transf16 b) { return a * b; }
+};
+
+template <> struct Monoid<PPerm16> {
+    static const PPerm16 one() { return PPerm16::one(); }
+    static PPerm16 prod(PPerm16 a, PPerm16 b) { return a * b; }
+};
+
 }  // namespace power_helper
 
 inline Perm16 Perm16::inverse_cycl() const {
@@ -386,4 +562,214 @@ inline bool Perm16::left_weak_leq_length(Perm16 other) const {
     return other.length() == length() + prod.length();
 }
 
+inline bool Perm16::right_weak_leq_ref(Perm16 other) const {
+    Perm16 sinv = inverse_ref(), oinv = other.inverse_ref();
+    for (size_t i = 0; i < 16; i++) {
+        for (size_t j = i + 1; j < 16; j++) {
+            if ((sinv[i] > sinv[j]) && (oinv[i] < oinv[j]))
+                return false;
+        }
+    }
+    return true;
+}
+
+namespace detail {
+
+// Bit matrix of the inversions of a permutation: bit j of row i is set if
+// i < j and v[i] > v[j].
+inline std::array<uint32_t, 16> inversions_bitmat(epu8 v) {
+    std::array<uint32_t, 16> res;
+    for (size_t i = 0; i < 16; i++)
+        res[i] = simde_mm_movemask_epi8(Epu8(v[i]) > v) & (0xFFFE << i);
+    return res;
+}
+
+// Close the inversions in place and returns the associated permutation.
+inline epu8 weak_closure_to_perm(std::array<uint32_t, 16> &inv) {
+    for (size_t k = 1; k < 16; k++)
+        for (size_t i = 0; i < k; i++)
+            inv[i] |= inv[k] & -((inv[i] >> k) & 1);
+    // res[i] = #{j < i, (j, i) not inversion} + #{j > i, (i, j) inversion}
+    decltype(Epu8)::array rows;
+    epu8 cols = Epu8.id();
+    for (size_t i = 0; i < 16; i++) {
+        rows[i] = __builtin_popcount(inv[i]);
+        cols += mask_from_bitset(inv[i]);
+    }
+    return Epu8(rows) + cols;
+}
+
+// Boolean matrix of a relation on the positions, only used for i < j
+using weak_relation_ref = std::array<std::array<bool, 16>, 16>;
+
+// Close the relation in place with Warshall's algorithm.
+inline void weak_closure_ref(weak_relation_ref &rel) {
+    for (size_t k = 0; k < 16; k++)
+        for (size_t i = 0; i < k; i++)
+            for (size_t j = k + 1; j < 16; j++)
+                if (rel[i][k] && rel[k][j])
+                    rel[i][j] = true;
+}
+
+// The permutation whose set of inversions is inv.
+inline Perm16 perm_of_inversions_ref(weak_relation_ref const &inv) {
+    Perm16 res = Perm16::one();
+    for (size_t i = 0; i < 16; i++) {
+        uint8_t r = 0;
+        for (size_t j = 0; j < i; j++)
+            r += !inv[j][i];
+        for (size_t j = i + 1; j < 16; j++)
+            r += inv[i][j];
+        res[i] = r;
+    }
+    return res;
+}
+
+}  // namespace detail
+
+inline Perm16 Perm16::left_weak_join_ref(Perm16 other) const {
+    detail::weak_relation_ref inv{};
+    for (size_t i = 0; i < 16; i++)
+        for (size_t j = i + 1; j < 16; j++)
+            inv[i][j] = v[i] > v[j] || other[i] > other[j];
+    detail::weak_closure_ref(inv);
+    return detail::perm_of_inversions_ref(inv);
+}
+
+inline Perm16 Perm16::left_weak_meet_ref(Perm16 other) const {
+    detail::weak_relation_ref noninv{};
+    for (size_t i = 0; i < 16; i++)
+        for (size_t j = i + 1; j < 16; j++)
+            noninv[i][j] = v[i] < v[j] || other[i] < other[j];
+    detail::weak_closure_ref(noninv);
+    detail::weak_relation_ref inv{};
+    for (size_t i = 0; i < 16; i++)
+        for (size_t j = i + 1; j < 16; j++)
+            inv[i][j] = !noninv[i][j];
+    return detail::perm_of_inversions_ref(inv);
+}
+
+inline Perm16 Perm16::left_weak_join(Perm16 other) const {
+    auto inv = detail::inversions_bitmat(v);
+    auto oinv = detail::inversions_bitmat(other.v);
+    for (size_t i = 0; i < 16; i++)
+        inv[i] |= oinv[i];
+    return detail::weak_closure_to_perm(inv);
+}
+
+inline Perm16 Perm16::left_weak_meet(Perm16 other) const {
+    // x -> w0 * x is an anti-automorphism of the left weak order
+    const Perm16 w0 = Epu8.rev();
+    return w0 * (w0 * *this).left_weak_join(w0 * other);
+}
+
+inline bool Perm16::bruhat_leq_ref(Perm16 other) const {
+    for (size_t k = 1; k <= 16; k++) {
+        std::array<uint8_t, 16> a = as_array(), b = other.as_array();
+        std::sort(a.begin(), a.begin() + k);
+        std::sort(b.begin(), b.begin() + k);
+        for (size_t i = 0; i < k; i++)
+            if (a[i] > b[i])
+                return false;
+    }
+    return true;
+}
+
+inline bool Perm16::bruhat_leq(Perm16 other) const {
+    // The maximum of the prefixes is the last row of the tableau criterion
+    if (!is_all_zero(HPCombi::partial_max(v) >
+                     HPCombi::partial_max(other.v)))
+        return false;
+    epu8 thr{};
+    for (int j = 1; j < 16; j++) {
+        thr += Epu8(1);
+        epu8 rs{}, ro{};
+        rs -= (v >= thr);
+        ro -= (other.v >= thr);
+        if (!is_all_zero(HPCombi::partial_sums(rs) >
+                         HPCombi::partial_sums(ro)))
+            return false;
+    }
+    return true;
+}
+
+inline uint32_t Perm16::descents_bitset_ref() const {
+    uint32_t res = 0;
+    for (size_t i = 0; i < 16 - 1; i++)
+        if (v[i] > v[i + 1])
+            res |= 1 << i;
+    return res;
+}
+
+inline std::vector<uint8_t> Perm16::reduced_word_ref() const {
+    std::vector<uint8_t> res;
+    std::array<uint8_t, 16> ar = as_array();
+    for (size_t i = 0; i < 16; i++) {
+        for (size_t j = 15; j > i; j--) {
+            if (ar[j - 1] > ar[j]) {
+                std::swap(ar[j - 1], ar[j]);
+                res.push_back(j - 1);
+            }
+        }
+    }
+    std::reverse(res.begin(), res.end());
+    return res;
+}
+
+inline std::vector<uint8_t> Perm16::reduced_word() const {
+    std::vector<uint8_t> res(length());
+    Perm16 p = *this;
+    for (size_t k = res.size(); k > 0; k--) {
+        uint32_t i = __builtin_ctz(p.descents_bitset());
+        res[k - 1] = i;
+        epu8 si = Epu8(uint8_t(i));
+        p = HPCombi::permuted(p.v, Epu8.id() - (Epu8.id() == si) +
+                                       (Epu8.id() == si + Epu8(1)));
+    }
+    return res;
+}
+
+inline std::vector<Perm16> conjugate_all(std::vector<Perm16> const &elems,
+                                         Perm16 g) {
+    std::vector<Perm16> res(elems.size());
+    Perm16 ginv = g.inverse();
+    for (size_t i = 0; i < elems.size(); i++)
+        res[i] = ginv * elems[i] * g;
+    return res;
+}
+
+inline std::vector<Perm16>
+right_coset_reps(std::vector<Perm16> const &gens,
+                 std::vector<Perm16> const &subgens) {
+    // List the elements of the subgroup
+    std::vector<Perm16> sub{Perm16::one()};
+    std::unordered_set<epu8> seen{Perm16::one().v};
+    for (size_t i = 0; i < sub.size(); i++) {
+        for (auto s : subgens) {
+            Perm16 x = sub[i] * s;
+            if (seen.insert(x.v).second)
+                sub.push_back(x);
+        }
+    }
+    auto coset_rep = [&sub](Perm16 x) {
+        epu8 res = x.v;
+        for (auto h : sub) {
+            epu8 y = HPCombi::permuted(h.v, x.v);
+            if (less(y, res))
+                res = y;
+        }
+        return Perm16(res);
+    };
+    std::vector<Perm16> res{Perm16::one()};
+    seen = {Perm16::one().v};
+    for (size_t i = 0; i < res.size(); i++) {
+        for (auto g : gens) {
+            Perm16 x = coset_rep(res[i] * g);
+            if (seen.insert(x.v).second)
+                res.push_back(x);
+        }
+    }
+    return res;
+}
+
 }  // namespace HPCombi
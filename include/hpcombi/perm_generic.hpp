@@ -30,10 +30,10 @@
 #include <functional>        // for hash
 #include <initializer_list>  // for initializer_list
 #include <memory>            // for hash
-#include <random>            // for mt19937
 #include <type_traits>       // for is_trivial
 
 #include "debug.hpp"         // for HPCOMBI_ASSERT
+#include "random.hpp"        // for random_stream
 #include "vect_generic.hpp"  // for VectGeneric
 
 namespace HPCombi {
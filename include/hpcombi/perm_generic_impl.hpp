@@ -53,11 +53,8 @@ PermGeneric<Size, Expo> PermGeneric<Size, Expo>::inverse() const {
 
 template <size_t Size, typename Expo>
 PermGeneric<Size, Expo> PermGeneric<Size, Expo>::random() {
-    static std::random_device rd;
-    static std::mt19937 g(rd());
-
     PermGeneric res{{}};
-    std::shuffle(res.v.begin(), res.v.end(), g);
+    std::shuffle(res.v.begin(), res.v.end(), random_stream());
     return res;
 }
 
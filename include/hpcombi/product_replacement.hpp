@@ -0,0 +1,110 @@
+//****************************************************************************//
+//     Copyright (C) 2016-2024 Florent Hivert <Florent.Hivert@lisn.fr>,       //
+//                                                                            //
+//  This file is part of HP-Combi <https://github.com/libsemigroups/HPCombi>  //
+//                                                                            //
+//  HP-Combi is free software: you can redistribute it and/or modify it       //
+//  under the terms of the GNU General Public License as published by the     //
+//  Free Software Foundation, either version 3 of the License, or             //
+//  (at your option) any later version.                                       //
+//                                                                            //
+//  HP-Combi is distributed in the hope that it will be useful, but WITHOUT   //
+//  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or     //
+//  FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License      //
+//  for  more details.                                                        //
+//                                                                            //
+//  You should have received a copy of the GNU General Public License along   //
+//  with HP-Combi. If not, see <https://www.gnu.org/licenses/>.               //
+//****************************************************************************//
+
+/** @file
+@brief declaration of HPCombi::ProductReplacement */
+
+#ifndef HPCOMBI_PRODUCT_REPLACEMENT_HPP_
+#define HPCOMBI_PRODUCT_REPLACEMENT_HPP_
+
+#include <algorithm>  // for all_of, max
+#include <cstddef>    // for size_t
+#include <cstdint>    // for uint64_t
+#include <vector>     // for vector
+
+#include "debug.hpp"   // for HPCOMBI_ASSERT
+#include "power.hpp"   // for Monoid
+#include "random.hpp"  // for RandomStream, random_stream
+
+namespace HPCombi {
+
+/** Pseudo random elements of the monoid generated by a few elements, without
+enumerating it.
+
+@tparam T the type of the elements, eg #HPCombi::Perm16,
+    #HPCombi::Transf16 or #HPCombi::BMat8
+@tparam M the monoid structure used for the products; see
+    #HPCombi::power_helper::Monoid
+
+@par Algorithm:
+Product replacement with an accumulator, as in Leedham-Green's rattle: a pool
+of elements is initialized with copies of the generators, which are also kept
+in fixed slots of their own. Each step chooses a slot @f$i@f$ of the pool and
+another slot or a generator @f$x@f$ at random, and replaces @f$s_i@f$ by
+@f$s_i x@f$ or @f$x s_i@f$; then it multiplies the accumulator @f$a@f$ on the
+left or on the right by a random slot or generator, and returns it, so that
+each element costs two products. The first steps are discarded to mix the
+pool.
+
+For groups, the distribution of the output quickly gets close to uniform, as
+for the classical algorithm of Celler, Leedham-Green, Murray, Niemeyer and
+O'Brien. For non-group monoids long products drift towards the minimal
+ideal; so, as soon as a generator is not a unit, each step also restarts
+@f$s_i@f$ from a generator and @f$a@f$ from @f$s_i@f$ with probability
+@f$1/3@f$ each, so that the output still has elements of full and
+intermediate rank.
+
+Each sampler owns its pool and its #HPCombi::RandomStream, so that several
+samplers can be used in parallel in different threads.
+*/
+template <typename T, typename M = power_helper::Monoid<T>>
+class ProductReplacement {
+ public:
+    /** A sampler for the monoid generated by \p gens.
+     * @param gens the generators
+     * @param seed the seed of the random stream of \c *this
+     * @param pool_size the size of the pool, which is raised to 2 if it is
+     *    smaller; 0 means the default @f$\max(10, 2|gens|)@f$
+     * @param burn_in the number of steps discarded at construction
+     */
+    ProductReplacement(std::vector<T> const &gens, uint64_t seed,
+                       size_t pool_size = 0, size_t burn_in = 100);
+
+    /** A sampler for the monoid generated by \p gens, seeded from
+     * #HPCombi::random_stream */
+    explicit ProductReplacement(std::vector<T> const &gens)
+        : ProductReplacement(gens, random_stream()()) {}
+
+    //! The next pseudo random element
+    T operator()();
+
+    //! The \p n next pseudo random elements
+    std::vector<T> sample(size_t n);
+
+    //! The size of the pool
+    size_t pool_size() const noexcept { return _pool.size(); }
+
+ private:
+    std::vector<T> _gens;
+    std::vector<T> _pool;
+    T _acc;
+    RandomStream _gen;
+    // The inverse probability of a restart, 0 for never
+    size_t _restart;
+
+    // Whether a power of x up to the 256-th is the identity; this covers the
+    // permutations of 16 points, whose order is at most 140
+    static bool is_unit(T const &x);
+};
+
+}  // namespace HPCombi
+
+#include "product_replacement_impl.hpp"
+
+#endif  // HPCOMBI_PRODUCT_REPLACEMENT_HPP_
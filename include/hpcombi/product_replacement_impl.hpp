@@ -0,0 +1,96 @@
+//****************************************************************************//
+//     Copyright (C) 2016-2024 Florent Hivert <Florent.Hivert@lisn.fr>,       //
+//                                                                            //
+//  This file is part of HP-Combi <https://github.com/libsemigroups/HPCombi>  //
+//                                                                            //
+//  HP-Combi is free software: you can redistribute it and/or modify it       //
+//  under the terms of the GNU General Public License as published by the     //
+//  Free Software Foundation, either version 3 of the License, or             //
+//  (at your option) any later version.                                       //
+//                                                                            //
+//  HP-Combi is distributed in the hope that it will be useful, but WITHOUT   //
+//  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or     //
+//  FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License      //
+//  for  more details.                                                        //
+//                                                                            //
+//  You should have received a copy of the GNU General Public License along   //
+//  with HP-Combi. If not, see <https://www.gnu.org/licenses/>.               //
+//****************************************************************************//
+
+// NOLINT(build/header_guard)
+
+/** @file
+@brief implementation of product_replacement.hpp ; this file should not be
+included directly.
+*/
+
+namespace HPCombi {
+
+template <typename T, typename M>
+ProductReplacement<T, M>::ProductReplacement(std::vector<T> const &gens,
+                                             uint64_t seed, size_t pool_size,
+                                             size_t burn_in)
+    : _gens(gens), _pool(), _acc(M::one()), _gen(seed), _restart(0) {
+    if (_gens.empty())
+        _gens.push_back(M::one());
+    if (!std::all_of(_gens.begin(), _gens.end(), is_unit))
+        _restart = 3;
+    if (pool_size == 0)
+        pool_size = std::max<size_t>(10, 2 * gens.size());
+    // Two distinct slots are needed by each step
+    pool_size = std::max<size_t>(2, pool_size);
+    _pool.reserve(pool_size);
+    for (size_t i = 0; i < pool_size; i++)
+        _pool.push_back(_gens[i % _gens.size()]);
+    for (size_t i = 0; i < burn_in; i++)
+        (*this)();
+}
+
+template <typename T, typename M> T ProductReplacement<T, M>::operator()() {
+    uint64_t r = _gen();
+    // Successive uniform digits in [0, k) of a single draw
+    auto digit = [&r](size_t k) {
+        size_t res = (static_cast<unsigned __int128>(r) * k) >> 64;
+        r *= k;
+        return res;
+    };
+    size_t const n = _pool.size(), g = _gens.size();
+    size_t const i = digit(n);
+    T &s = _pool[i];
+    if (_restart != 0 && digit(_restart) == 0) {
+        s = _gens[digit(g)];
+    } else {
+        // Another slot or a generator
+        size_t const j = digit(n - 1 + g);
+        T const &x = j < n - 1 ? _pool[j + (j >= i)] : _gens[j - (n - 1)];
+        s = digit(2) ? M::prod(s, x) : M::prod(x, s);
+    }
+    if (_restart != 0 && digit(_restart) == 0) {
+        _acc = s;
+    } else {
+        size_t const k = digit(n + g);
+        T const &y = k < n ? _pool[k] : _gens[k - n];
+        _acc = digit(2) ? M::prod(_acc, y) : M::prod(y, _acc);
+    }
+    return _acc;
+}
+
+template <typename T, typename M>
+bool ProductReplacement<T, M>::is_unit(T const &x) {
+    T pow = x;
+    for (size_t i = 0; i < 256; i++, pow = M::prod(pow, x))
+        if (pow == M::one())
+            return true;
+    return false;
+}
+
+template <typename T, typename M>
+std::vector<T> ProductReplacement<T, M>::sample(size_t n) {
+    std::vector<T> res;
+    res.reserve(n);
+    for (size_t i = 0; i < n; i++)
+        res.push_back((*this)());
+    return res;
+}
+
+}  // namespace HPCombi
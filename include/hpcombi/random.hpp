@@ -0,0 +1,129 @@
+//****************************************************************************//
+//     Copyright (C) 2016-2024 Florent Hivert <Florent.Hivert@lisn.fr>,       //
+//                                                                            //
+//  This file is part of HP-Combi <https://github.com/libsemigroups/HPCombi>  //
+//                                                                            //
+//  HP-Combi is free software: you can redistribute it and/or modify it       //
+//  under the terms of the GNU General Public License as published by the     //
+//  Free Software Foundation, either version 3 of the License, or             //
+//  (at your option) any later version.                                       //
+//                                                                            //
+//  HP-Combi is distributed in the hope that it will be useful, but WITHOUT   //
+//  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or     //
+//  FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License      //
+//  for  more details.                                                        //
+//                                                                            //
+//  You should have received a copy of the GNU General Public License along   //
+//  with HP-Combi. If not, see <https://www.gnu.org/licenses/>.               //
+//****************************************************************************//
+
+/** @file
+@brief declaration of HPCombi::RandomStream, the random generator used by the
+\c random methods of HPCombi */
+
+#ifndef HPCOMBI_RANDOM_HPP_
+#define HPCOMBI_RANDOM_HPP_
+
+#include <atomic>   // for atomic
+#include <cstdint>  // for uint64_t
+#include <random>   // for random_device
+
+#include "simde/x86/sse2.h"  // for simde__m128i, simde_mm_set_epi64x
+
+namespace HPCombi {
+
+/** A counter based pseudo random generator.
+
+The \c i-th output of a stream with key \c k is a fixed mixing function of
+@f$k + i\gamma@f$, where @f$\gamma@f$ is an odd constant; this is the
+SplitMix64 generator of Steele, Lea and Flood, which passes BigCrush. Being
+counter based, the state is two integers, #discard is constant time and
+streams with different keys are independent for all practical purposes.
+
+A RandomStream is a \c UniformRandomBitGenerator, so it can be passed to
+\c std::shuffle or to the distributions of \c <random>.
+
+The \c random methods of HPCombi (#HPCombi::random_epu8,
+#HPCombi::Perm16::random, #HPCombi::BMat8::random, ...) draw from the
+thread local stream #HPCombi::random_stream, so that they are thread safe
+and can be made reproducible with #HPCombi::set_random_seed.
+*/
+class RandomStream {
+ public:
+    using result_type = uint64_t;
+
+    //! A stream with key derived from \p seed
+    explicit RandomStream(uint64_t seed = 0) noexcept { this->seed(seed); }
+
+    //! Restart \c *this from the beginning of the stream given by \p seed
+    void seed(uint64_t seed) noexcept {
+        _key = mix(seed);
+        _counter = 0;
+    }
+
+    static constexpr result_type min() noexcept { return 0; }
+    static constexpr result_type max() noexcept { return ~uint64_t(0); }
+
+    //! The next 64 random bits
+    result_type operator()() noexcept { return mix(_key + ++_counter * gamma); }
+
+    /** The next 128 random bits, that is the next two outputs of \c *this
+     * in the low and the high half.
+     * @par Algorithm: the mixing function needs a 64×64 bits product, which
+     * has no SIMD instruction before AVX-512, so that the two words are
+     * mixed by scalar code; the two computations are independent and are
+     * interleaved by the processor.
+     */
+    simde__m128i next128() noexcept {
+        uint64_t lo = mix(_key + (_counter + 1) * gamma);
+        uint64_t hi = mix(_key + (_counter + 2) * gamma);
+        _counter += 2;
+        return simde_mm_set_epi64x(hi, lo);
+    }
+
+    /** A random integer in @f$[0, bound)@f$
+     * @details The bias is less than @f$bound / 2^{64}@f$.
+     * @par Algorithm: high part of a 64×64 bits product (Lemire).
+     */
+    uint64_t below(uint64_t bound) noexcept {
+        return (static_cast<unsigned __int128>((*this)()) * bound) >> 64;
+    }
+
+    //! Skip the next \p n outputs
+    void discard(uint64_t n) noexcept { _counter += n; }
+
+    //! The SplitMix64 mixing function, a bijection of the 64 bits integers
+    static constexpr uint64_t mix(uint64_t z) noexcept {
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+        return z ^ (z >> 31);
+    }
+
+ private:
+    static constexpr uint64_t gamma = 0x9e3779b97f4a7c15;
+    uint64_t _key;
+    uint64_t _counter;
+};
+
+/** The random stream of the calling thread.
+ * @details The stream of each thread is created on first use, with a seed
+ * derived from the global seed and the number of threads which used their
+ * stream before. The global seed is nondeterministic unless
+ * #HPCombi::set_random_seed is called.
+ */
+inline RandomStream &random_stream();
+
+/** Set the global seed and restart the stream of the calling thread from it.
+ * @details All the random methods of HPCombi called afterwards in the
+ * calling thread return the same values for the same seed. The threads whose
+ * stream is not created yet get a seed derived from \p seed. For
+ * reproducible multithreaded computations, each thread should call
+ * #HPCombi::set_random_seed itself.
+ */
+inline void set_random_seed(uint64_t seed);
+
+}  // namespace HPCombi
+
+#include "random_impl.hpp"
+
+#endif  // HPCOMBI_RANDOM_HPP_
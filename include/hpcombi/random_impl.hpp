@@ -0,0 +1,56 @@
+//****************************************************************************//
+//     Copyright (C) 2016-2024 Florent Hivert <Florent.Hivert@lisn.fr>,       //
+//                                                                            //
+//  This file is part of HP-Combi <https://github.com/libsemigroups/HPCombi>  //
+//                                                                            //
+//  HP-Combi is free software: you can redistribute it and/or modify it       //
+//  under the terms of the GNU General Public License as published by the     //
+//  Free Software Foundation, either version 3 of the License, or             //
+//  (at your option) any later version.                                       //
+//                                                                            //
+//  HP-Combi is distributed in the hope that it will be useful, but WITHOUT   //
+//  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or     //
+//  FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License      //
+//  for  more details.                                                        //
+//                                                                            //
+//  You should have received a copy of the GNU General Public License along   //
+//  with HP-Combi. If not, see <https://www.gnu.org/licenses/>.               //
+//****************************************************************************//
+
+// NOLINT(build/header_guard)
+
+/** @file
+@brief implementation of random.hpp ; this file should not be included
+directly.
+*/
+
+namespace HPCombi {
+
+namespace detail {
+
+inline std::atomic<uint64_t> &global_random_seed() {
+    static std::atomic<uint64_t> seed{(uint64_t(std::random_device()()) << 32) ^
+                                      std::random_device()()};
+    return seed;
+}
+
+inline std::atomic<uint64_t> &random_stream_counter() {
+    static std::atomic<uint64_t> counter{0};
+    return counter;
+}
+
+}  // namespace detail
+
+inline RandomStream &random_stream() {
+    thread_local RandomStream stream(
+        detail::global_random_seed() ^
+        RandomStream::mix(++detail::random_stream_counter()));
+    return stream;
+}
+
+inline void set_random_seed(uint64_t seed) {
+    detail::global_random_seed() = seed;
+    random_stream().seed(seed);
+}
+
+}  // namespace HPCombi
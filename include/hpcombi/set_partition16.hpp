@@ -0,0 +1,223 @@
+//****************************************************************************//
+//    Copyright (C) 2018-2024 Finn Smith <fls3@st-andrews.ac.uk>              //
+//    Copyright (C) 2018-2024 James Mitchell <jdm3@st-andrews.ac.uk>          //
+//    Copyright (C) 2018-2024 Florent Hivert <Florent.Hivert@lisn.fr>,        //
+//                                                                            //
+//  This file is part of HP-Combi <https://github.com/libsemigroups/HPCombi>  //
+//                                                                            //
+//  HP-Combi is free software: you can redistribute it and/or modify it       //
+//  under the terms of the GNU General Public License as published by the     //
+//  Free Software Foundation, either version 3 of the License, or             //
+//  (at your option) any later version.                                       //
+//                                                                            //
+//  HP-Combi is distributed in the hope that it will be useful, but WITHOUT   //
+//  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or     //
+//  FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License      //
+//  for  more details.                                                        //
+//                                                                            //
+//  You should have received a copy of the GNU General Public License along   //
+//  with HP-Combi. If not, see <https://www.gnu.org/licenses/>.               //
+//****************************************************************************//
+
+/** @file
+@brief declaration of HPCombi::SetPartition16 */
+
+#ifndef HPCOMBI_SET_PARTITION16_HPP_
+#define HPCOMBI_SET_PARTITION16_HPP_
+
+#include <algorithm>         // for max, min
+#include <array>             // for array
+#include <cstddef>           // for size_t
+#include <cstdint>           // for uint8_t, uint64_t
+#include <functional>        // for hash
+#include <initializer_list>  // for initializer_list
+#include <type_traits>       // for is_trivial
+#include <utility>           // for forward
+#include <vector>            // for vector
+
+#include "debug.hpp"     // for HPCOMBI_ASSERT
+#include "epu8.hpp"      // for epu8, permuted, partial_sums, horiz_max
+#include "hash.hpp"      // for FastHash
+#include "parallel.hpp"  // for for_each_batch_threaded
+#include "perm16.hpp"    // for Transf16
+#include "vect16.hpp"    // for Vect16
+
+namespace HPCombi {
+
+namespace detail {
+
+/** The Bell number @f$B_n@f$ of set partitions of an @f$n@f$-set, for
+ * @f$0 \leq n \leq 16@f$ */
+constexpr std::array<uint64_t, 17> bell_numbers = [] {
+    // Bell triangle: each row starts with the last entry of the previous one
+    std::array<uint64_t, 17> res{}, row{}, prev{};
+    prev[0] = res[0] = 1;
+    for (size_t n = 1; n < 17; n++) {
+        row[0] = prev[n - 1];
+        for (size_t k = 1; k <= n; k++)
+            row[k] = row[k - 1] + prev[k - 1];
+        res[n] = row[0];
+        prev = row;
+    }
+    return res;
+}();
+
+}  // namespace detail
+
+/** Set partitions of @f$\{0\dots n-1\}@f$ for @f$n \leq 16@f$, stored as
+restricted growth strings.
+
+Entry @f$i@f$ is the index of the block of @f$i@f$, the blocks being numbered
+in the order of their smallest element, so that @f$v_0 = 0@f$ and @f$v_i \leq
+1 + \max(v_0, \dots, v_{i-1})@f$. The entries @f$i \geq n@f$ are 0xFF. This is
+the canonical form of the kernel of a transformation, see #kernel, and the
+comparison operators of #HPCombi::Vect16 are the lexicographic order of the
+strings.
+
+The partitions are ordered by refinement: #one_block is the largest and
+#discrete the smallest one.
+*/
+struct alignas(16) SetPartition16 : public Vect16 {
+    using vect = HPCombi::Vect16;
+
+    SetPartition16() = default;
+    constexpr SetPartition16(const SetPartition16 &v) = default;
+    /* implicit */ constexpr SetPartition16(const vect v)  // NOLINT
+        : Vect16(v) {}
+    /* implicit */ constexpr SetPartition16(const epu8 x)  // NOLINT
+        : Vect16(x) {}
+    SetPartition16(std::initializer_list<uint8_t> il) : Vect16(il, 0xFF) {}
+    SetPartition16 &operator=(const SetPartition16 &) = default;
+
+    //! Return whether \c *this is a well constructed object
+    bool validate() const;
+
+    //! The number @f$n@f$ of elements of the partitioned set
+    size_t degree() const noexcept {
+        return __builtin_popcount(simde_mm_movemask_epi8(v != Epu8(0xFF)));
+    }
+
+    //! The number of blocks of \c *this, which is 0 for the empty set
+    size_t nb_blocks() const noexcept {
+        // The padding 0xFF wraps to 0
+        return HPCombi::horiz_max(v + Epu8(1));
+    }
+
+    /** The partition of @f$\{0\dots n-1\}@f$ whose blocks are the fibers of
+     * \p labels, that is @f$i, j@f$ are in the same block if and only if
+     * <tt>labels[i] == labels[j]</tt>; the entries @f$i \geq n@f$ of
+     * \p labels are ignored.
+     * @par Algorithm: the smallest element of the block of each @f$i@f$ is
+     * found by comparing \p labels with its 15 rotations; its index is then
+     * given by #HPCombi::partial_sums of the mask of the smallest elements.
+     */
+    static SetPartition16 from_labels(epu8 labels, size_t n = 16) noexcept;
+
+    /** Same interface as #from_labels but with a different implementation;
+     * scalar reference version */
+    static SetPartition16 from_labels_ref(epu8 labels, size_t n = 16);
+
+    /** The finest partition coarser than both \c *this and \p other, which
+     * must have the same #degree
+     * @par Algorithm: each element is labelled by the smallest element of
+     * its block in \c *this, then the minimum of the labels is taken
+     * alternately over the blocks of \p other and of \c *this, until it no
+     * longer changes; the number of rounds is at most the length of the
+     * longest chain of blocks alternately from each partition.
+     */
+    SetPartition16 join(SetPartition16 const &other) const noexcept;
+
+    /** The coarsest partition finer than both \c *this and \p other, which
+     * must have the same #degree, that is the intersections of their blocks
+     * @par Algorithm: #from_labels of the pairs of block indices, packed
+     * into a byte.
+     */
+    SetPartition16 meet(SetPartition16 const &other) const noexcept {
+        HPCOMBI_ASSERT(degree() == other.degree());
+        return from_labels((v << 4) | other.v, degree());
+    }
+
+    /** Whether each block of \c *this is included in a block of \p other,
+     * which must have the same #degree */
+    bool refines(SetPartition16 const &other) const noexcept;
+
+    /** Replace \c *this by the next partition of the same set in the
+     * lexicographic order of the restricted growth strings
+     * @returns \c false and resets \c *this to #one_block if \c *this was
+     * #discrete, \c true otherwise, in the manner of
+     * \c std::next_permutation.
+     * @par Algorithm: the last entry which is at most the maximum of the
+     * previous ones is incremented and the following ones are reset to 0,
+     * using #HPCombi::partial_max; each step is a constant number of vector
+     * instructions.
+     */
+    bool next_lex() noexcept;
+
+    //! The partition of @f$\{0\dots n-1\}@f$ with a single block
+    static SetPartition16 one_block(size_t n) noexcept {
+        HPCOMBI_ASSERT(n <= 16);
+        return Epu8.id() >= Epu8(uint8_t(n));
+    }
+
+    //! The partition of @f$\{0\dots n-1\}@f$ into singletons
+    static SetPartition16 discrete(size_t n) noexcept {
+        HPCOMBI_ASSERT(n <= 16);
+        return Epu8.id() | (Epu8.id() >= Epu8(uint8_t(n)));
+    }
+
+    //! The Bell number of partitions of an \p n-set
+    static uint64_t count(size_t n) noexcept {
+        HPCOMBI_ASSERT(n <= 16);
+        return detail::bell_numbers[n];
+    }
+
+    /** The partitions of @f$\{0\dots n-1\}@f$ in lexicographic order, using
+     * #next_lex; there are 4213597 of them for @f$n = 12@f$ */
+    static std::vector<SetPartition16> all(size_t n);
+
+    /** Call \p fun on all the partitions of @f$\{0\dots n-1\}@f$, in
+     * batches.
+     * @param n the size of the set, in practice at most 13
+     * @param fun a callable taking a
+     *    <tt>std::vector<SetPartition16> const &</tt>; it is called
+     *    concurrently from several threads when \p nr_threads is not 1, and
+     *    must then be thread safe
+     * @param nr_threads the number of threads; 0 means
+     *    <tt>std::thread::hardware_concurrency()</tt>
+     * @param batch_size the maximal size of the batches passed to \p fun
+     * @details The strings are cut after their first 6 entries into
+     * independent tasks, which are distributed dynamically among the
+     * threads; the order of the partitions is not specified.
+     */
+    template <typename Fun>
+    static void for_each_batch(size_t n, Fun &&fun, size_t nr_threads = 0,
+                               size_t batch_size = 1024);
+};
+
+static_assert(std::is_trivial<SetPartition16>(),
+              "SetPartition16 is not a trivial class !");
+
+/** The kernel of \p t, that is the partition of @f$\{0\dots 15\}@f$ whose
+ * blocks are the preimages of the points of the image of \p t */
+inline SetPartition16 kernel(Transf16 const &t) noexcept {
+    return SetPartition16::from_labels(t);
+}
+
+}  // namespace HPCombi
+
+#include "set_partition16_impl.hpp"
+
+namespace std {
+
+//! This type appears in the doc because we provide a hash function for
+//! HPCombi::SetPartition16.
+template <> struct hash<HPCombi::SetPartition16> {
+    //! A hash operator for #HPCombi::SetPartition16
+    size_t operator()(const HPCombi::SetPartition16 &ar) const {
+        return HPCombi::FastHash<HPCombi::SetPartition16>{}(ar);
+    }
+};
+
+}  // namespace std
+
+#endif  // HPCOMBI_SET_PARTITION16_HPP_
@@ -0,0 +1,162 @@
+//****************************************************************************//
+//    Copyright (C) 2018-2024 Finn Smith <fls3@st-andrews.ac.uk>              //
+//    Copyright (C) 2018-2024 James Mitchell <jdm3@st-andrews.ac.uk>          //
+//    Copyright (C) 2018-2024 Florent Hivert <Florent.Hivert@lisn.fr>,        //
+//                                                                            //
+//  This file is part of HP-Combi <https://github.com/libsemigroups/HPCombi>  //
+//                                                                            //
+//  HP-Combi is free software: you can redistribute it and/or modify it       //
+//  under the terms of the GNU General Public License as published by the     //
+//  Free Software Foundation, either version 3 of the License, or             //
+//  (at your option) any later version.                                       //
+//                                                                            //
+//  HP-Combi is distributed in the hope that it will be useful, but WITHOUT   //
+//  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or     //
+//  FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License      //
+//  for  more details.                                                        //
+//                                                                            //
+//  You should have received a copy of the GNU General Public License along   //
+//  with HP-Combi. If not, see <https://www.gnu.org/licenses/>.               //
+//****************************************************************************//
+
+// NOLINT(build/header_guard)
+
+/** @file
+@brief implementation of set_partition16.hpp ; this file should not be
+included directly.
+*/
+
+namespace HPCombi {
+
+namespace detail {
+
+// For each i, the minimum of the vals[j] such that labels[j] == labels[i]
+inline epu8 block_min(epu8 labels, epu8 vals) noexcept {
+    epu8 res = vals, rot = Epu8.id();
+    for (size_t k = 1; k < 16; k++) {
+        rot = (rot + Epu8(1)) & Epu8(0x0F);
+        epu8 other = HPCombi::permuted(vals, rot);
+        res = HPCombi::min(
+            res, other | ~(labels == HPCombi::permuted(labels, rot)));
+    }
+    return res;
+}
+
+// The restricted growth string where each i is mapped to the smallest
+// element mins[i] of its block; the padding is left unspecified.
+inline epu8 rgs_from_mins(epu8 mins) noexcept {
+    epu8 starts = Epu8(1) & (mins == Epu8.id());
+    return HPCombi::permuted(HPCombi::partial_sums(starts), mins) - Epu8(1);
+}
+
+// Replace the entries lo <= i < hi of the restricted growth string v, with
+// lo > 0, by the next ones in lexicographic order, or by 0 if there is none.
+inline bool next_rgs(epu8 &v, size_t lo, size_t hi) noexcept {
+    epu8 const range =
+        (Epu8.id() >= Epu8(uint8_t(lo))) & (Epu8.id() < Epu8(uint8_t(hi)));
+    epu8 const prev_max = HPCombi::shifted_right(HPCombi::partial_max(v));
+    uint64_t pos = HPCombi::last_non_zero((v <= prev_max) & range, 16);
+    if (pos == 16) {
+        v &= ~range;
+        return false;
+    }
+    v -= Epu8.id() == Epu8(uint8_t(pos));  // adds 1 at pos
+    v &= ~((Epu8.id() > Epu8(uint8_t(pos))) & range);
+    return true;
+}
+
+}  // namespace detail
+
+inline bool SetPartition16::validate() const {
+    size_t const n = degree();
+    int max = -1;
+    for (size_t i = 0; i < 16; i++) {
+        if (i >= n) {
+            if (v[i] != 0xFF)
+                return false;
+        } else if (v[i] > max + 1) {
+            return false;
+        } else {
+            max = std::max<int>(max, v[i]);
+        }
+    }
+    return true;
+}
+
+inline SetPartition16 SetPartition16::from_labels(epu8 labels,
+                                                  size_t n) noexcept {
+    HPCOMBI_ASSERT(n <= 16);
+    epu8 mins = detail::block_min(labels, Epu8.id());
+    return detail::rgs_from_mins(mins) | (Epu8.id() >= Epu8(uint8_t(n)));
+}
+
+inline SetPartition16 SetPartition16::from_labels_ref(epu8 labels,
+                                                      size_t n) {
+    HPCOMBI_ASSERT(n <= 16);
+    SetPartition16 res = one_block(n);
+    uint8_t nb = 0;
+    for (size_t i = 0; i < n; i++) {
+        size_t j = 0;
+        while (labels[j] != labels[i])
+            j++;
+        res[i] = j == i ? nb++ : res[j];
+    }
+    return res;
+}
+
+inline SetPartition16
+SetPartition16::join(SetPartition16 const &other) const noexcept {
+    HPCOMBI_ASSERT(degree() == other.degree());
+    epu8 mins = detail::block_min(v, Epu8.id());
+    while (true) {
+        epu8 next = detail::block_min(v, detail::block_min(other.v, mins));
+        if (HPCombi::equal(next, mins))
+            break;
+        mins = next;
+    }
+    return detail::rgs_from_mins(mins) | (v == Epu8(0xFF));
+}
+
+inline bool SetPartition16::refines(SetPartition16 const &other) const
+    noexcept {
+    HPCOMBI_ASSERT(degree() == other.degree());
+    // The entries of other are constant on the blocks of *this
+    return HPCombi::equal(detail::block_min(v, other.v), other.v);
+}
+
+inline bool SetPartition16::next_lex() noexcept {
+    return detail::next_rgs(v, 1, degree());
+}
+
+inline std::vector<SetPartition16> SetPartition16::all(size_t n) {
+    std::vector<SetPartition16> res;
+    res.reserve(count(n));
+    SetPartition16 p = one_block(n);
+    do {
+        res.push_back(p);
+    } while (p.next_lex());
+    return res;
+}
+
+template <typename Fun>
+void SetPartition16::for_each_batch(size_t n, Fun &&fun, size_t nr_threads,
+                                    size_t batch_size) {
+    HPCOMBI_ASSERT(n <= 16);
+    // The tasks are the strings of length cut, completed by zeros
+    size_t const cut = std::min<size_t>(n, 6);
+    std::vector<epu8> todo;
+    epu8 prefix = one_block(n);
+    do {
+        todo.push_back(prefix);
+    } while (detail::next_rgs(prefix, 1, cut));
+    detail::for_each_batch_threaded<SetPartition16>(
+        todo,
+        [n, cut](epu8 p, auto &visit) {
+            do {
+                visit(SetPartition16(p));
+            } while (detail::next_rgs(p, std::max<size_t>(1, cut), n));
+        },
+        std::forward<Fun>(fun), nr_threads, batch_size);
+}
+
+}  // namespace HPCombi
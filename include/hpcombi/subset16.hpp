@@ -0,0 +1,262 @@
+//****************************************************************************//
+//     Copyright (C) 2016-2024 Florent Hivert <Florent.Hivert@lisn.fr>,       //
+//                                                                            //
+//  This file is part of HP-Combi <https://github.com/libsemigroups/HPCombi>  //
+//                                                                            //
+//  HP-Combi is free software: you can redistribute it and/or modify it       //
+//  under the terms of the GNU General Public License as published by the     //
+//  Free Software Foundation, either version 3 of the License, or             //
+//  (at your option) any later version.                                       //
+//                                                                            //
+//  HP-Combi is distributed in the hope that it will be useful, but WITHOUT   //
+//  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or     //
+//  FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License      //
+//  for  more details.                                                        //
+//                                                                            //
+//  You should have received a copy of the GNU General Public License along   //
+//  with HP-Combi. If not, see <https://www.gnu.org/licenses/>.               //
+//****************************************************************************//
+
+/** @file
+@brief declaration of HPCombi::Subset16 */
+
+#ifndef HPCOMBI_SUBSET16_HPP_
+#define HPCOMBI_SUBSET16_HPP_
+
+#include <array>             // for array
+#include <cstddef>           // for size_t
+#include <cstdint>           // for uint8_t, uint16_t, uint32_t, uint64_t
+#include <functional>        // for hash
+#include <initializer_list>  // for initializer_list
+#include <iterator>          // for forward_iterator_tag
+#include <ostream>           // for ostream
+#include <type_traits>       // for is_trivially_copyable
+
+#include "debug.hpp"  // for HPCOMBI_ASSERT
+#include "epu8.hpp"   // for epu8, mask_from_bitset, eval16
+#include "hash.hpp"   // for FastHash
+
+namespace HPCombi {
+
+namespace detail {
+
+/** Binomial coefficients @f$\binom{n}{k}@f$ for @f$0 \leq n, k \leq 16@f$ */
+constexpr std::array<std::array<uint16_t, 17>, 17> binomials = [] {
+    std::array<std::array<uint16_t, 17>, 17> res{};
+    for (size_t n = 0; n < 17; n++) {
+        res[n][0] = 1;
+        for (size_t k = 1; k <= n; k++)
+            res[n][k] = res[n - 1][k - 1] + res[n - 1][k];
+    }
+    return res;
+}();
+
+/** For each byte \c b, the positions of the bits set in \c b in increasing
+ * order, packed in the bytes of a uint64_t, padded with 0xFF */
+constexpr std::array<uint64_t, 256> bit_positions = [] {
+    std::array<uint64_t, 256> res{};
+    for (size_t b = 0; b < 256; b++) {
+        uint64_t v = ~uint64_t(0);
+        size_t c = 0;
+        for (size_t i = 0; i < 8; i++) {
+            if ((b >> i) & 1) {
+                v &= ~(uint64_t(0xFF) << (8 * c));
+                v |= uint64_t(i) << (8 * c);
+                c++;
+            }
+        }
+        res[b] = v;
+    }
+    return res;
+}();
+
+}  // namespace detail
+
+/** Subsets of @f$\{0\dots 15\}@f$ stored as a 16 bits bitset.
+
+Bit \c i is set if and only if \c i belongs to the subset. This is the same
+encoding as the bitsets returned by #HPCombi::PTransf16::image_bitset,
+#HPCombi::PTransf16::domain_bitset and the like, and as the result of
+\c simde_mm_movemask_epi8 on a mask.
+
+The order of subsets of the same size used for #rank, #unrank and #next_colex
+is the colexicographic order, that is the order of the bitsets as integers.
+
+Subset16 is a trivial class.
+*/
+class Subset16 {
+ public:
+    //! The empty set
+    constexpr Subset16() noexcept : _bits(0) {}
+
+    //! The subset whose bitset is \p bits
+    constexpr explicit Subset16(uint16_t bits) noexcept : _bits(bits) {}
+
+    //! The subset with elements \p elems; each element must be smaller than 16
+    Subset16(std::initializer_list<uint8_t> elems) noexcept;
+
+    //! The subset @f$\{0\dots n-1\}@f$
+    static constexpr Subset16 first(size_t n) noexcept {
+        return Subset16(uint16_t((uint32_t(1) << n) - 1));
+    }
+
+    /** The subset of the positions \c i such that \c mask[i] has its highest
+     * bit set, that is the inverse of #to_mask */
+    static Subset16 from_mask(epu8 mask) noexcept {
+        return Subset16(uint16_t(simde_mm_movemask_epi8(mask)));
+    }
+
+    /** The subset of the values smaller than 16 appearing in \p v
+     * @par Algorithm: test which entries of #HPCombi::eval16 are non zero
+     */
+    static Subset16 from_values(epu8 v) noexcept {
+        return from_mask(eval16(v) != epu8{});
+    }
+
+    //! The bitset of \c *this
+    constexpr uint16_t bits() const noexcept { return _bits; }
+
+    //! The mask whose entry \c i is 0xFF if \c i belongs to \c *this, else 0
+    epu8 to_mask() const noexcept { return mask_from_bitset(_bits); }
+
+    /** The elements of \c *this in increasing order followed by 0xFF
+     * @details This is the argument for #HPCombi::permuted which extracts
+     * the entries of a vector whose positions belong to \c *this.
+     * @par Example:
+     * @code
+     * Subset16({1, 4, 5}).to_gather()
+     * @endcode
+     * Returns @verbatim {1, 4, 5, 255, ..., 255} @endverbatim
+     * @par Algorithm: one lookup in a 256 entries table for each byte of
+     * the bitset, then a shuffle to concatenate the two halves.
+     */
+    epu8 to_gather() const noexcept;
+
+    //! The cardinality of \c *this
+    constexpr size_t size() const noexcept { return __builtin_popcount(_bits); }
+    //! Whether \c *this is empty
+    constexpr bool empty() const noexcept { return _bits == 0; }
+    //! Whether \p i belongs to \c *this
+    constexpr bool contains(size_t i) const noexcept {
+        return i < 16 && ((_bits >> i) & 1);
+    }
+    //! Whether \c *this is included in \p other
+    constexpr bool is_subset_of(Subset16 other) const noexcept {
+        return (_bits & ~other._bits) == 0;
+    }
+    //! The complement of \c *this in @f$\{0\dots n-1\}@f$
+    constexpr Subset16 complement(size_t n = 16) const noexcept {
+        return Subset16(uint16_t(~_bits & first(n)._bits));
+    }
+
+    constexpr Subset16 operator|(Subset16 o) const noexcept {
+        return Subset16(uint16_t(_bits | o._bits));
+    }
+    constexpr Subset16 operator&(Subset16 o) const noexcept {
+        return Subset16(uint16_t(_bits & o._bits));
+    }
+    constexpr Subset16 operator^(Subset16 o) const noexcept {
+        return Subset16(uint16_t(_bits ^ o._bits));
+    }
+    //! Set difference
+    constexpr Subset16 operator-(Subset16 o) const noexcept {
+        return Subset16(uint16_t(_bits & ~o._bits));
+    }
+    constexpr bool operator==(Subset16 o) const noexcept {
+        return _bits == o._bits;
+    }
+    constexpr bool operator!=(Subset16 o) const noexcept {
+        return _bits != o._bits;
+    }
+    //! Comparison of the bitsets, that is colexicographic order
+    constexpr bool operator<(Subset16 o) const noexcept {
+        return _bits < o._bits;
+    }
+
+    /** The rank of \c *this among the subsets of the same size in colex order
+     * @details The rank of @f$\{c_1 < \dots < c_k\}@f$ is
+     * @f$\sum_i \binom{c_i}{i}@f$.
+     */
+    size_t rank() const noexcept;
+
+    /** The \p r-th subset of size \p k in colex order; inverse of #rank.
+     * @details \p r must be smaller than @f$\binom{16}{k}@f$. This is not
+     * checked.
+     */
+    static Subset16 unrank(size_t k, size_t r) noexcept;
+
+    /** Replace \c *this by the next subset of the same size of
+     * @f$\{0\dots n-1\}@f$ in colex order.
+     * @returns \c false and resets \c *this to the first subset if \c *this
+     * was the last one, \c true otherwise, in the manner of
+     * \c std::next_permutation.
+     * @par Algorithm: Gosper's hack where the division is replaced by a shift
+     * by the number of trailing zeros.
+     */
+    bool next_colex(size_t n = 16) noexcept;
+
+    /** Call \p f on all the subsets of size \p k of @f$\{0\dots n-1\}@f$ in
+     * colex order */
+    template <typename Fun>
+    static void for_each_k_subset(size_t n, size_t k, Fun f);
+
+    //! Iterator over the elements of a Subset16 in increasing order
+    class const_iterator {
+     public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = uint8_t;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = uint8_t;
+
+        constexpr explicit const_iterator(uint16_t bits) noexcept
+            : _bits(bits) {}
+        uint8_t operator*() const noexcept { return __builtin_ctz(_bits); }
+        const_iterator &operator++() noexcept {
+            _bits &= _bits - 1;
+            return *this;
+        }
+        const_iterator operator++(int) noexcept {
+            const_iterator res = *this;
+            ++*this;
+            return res;
+        }
+        bool operator==(const_iterator o) const noexcept {
+            return _bits == o._bits;
+        }
+        bool operator!=(const_iterator o) const noexcept {
+            return _bits != o._bits;
+        }
+
+     private:
+        uint16_t _bits;
+    };
+
+    const_iterator begin() const noexcept { return const_iterator(_bits); }
+    const_iterator end() const noexcept { return const_iterator(0); }
+
+ private:
+    uint16_t _bits;
+};
+
+static_assert(std::is_trivially_copyable<Subset16>::value,
+              "Subset16 is not trivially copyable");
+
+//! The hash key of a #HPCombi::Subset16 is its bitset
+inline uint64_t hash_key(Subset16 s) noexcept { return s.bits(); }
+
+}  // namespace HPCombi
+
+namespace std {
+
+template <> struct hash<HPCombi::Subset16> {
+    size_t operator()(HPCombi::Subset16 s) const noexcept {
+        return HPCombi::FastHash<HPCombi::Subset16>{}(s);
+    }
+};
+
+}  // namespace std
+
+#include "subset16_impl.hpp"
+
+#endif  // HPCOMBI_SUBSET16_HPP_
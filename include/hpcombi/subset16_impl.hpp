@@ -0,0 +1,108 @@
+//****************************************************************************//
+//     Copyright (C) 2016-2024 Florent Hivert <Florent.Hivert@lisn.fr>,       //
+//                                                                            //
+//  This file is part of HP-Combi <https://github.com/libsemigroups/HPCombi>  //
+//                                                                            //
+//  HP-Combi is free software: you can redistribute it and/or modify it       //
+//  under the terms of the GNU General Public License as published by the     //
+//  Free Software Foundation, either version 3 of the License, or             //
+//  (at your option) any later version.                                       //
+//                                                                            //
+//  HP-Combi is distributed in the hope that it will be useful, but WITHOUT   //
+//  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or     //
+//  FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License      //
+//  for  more details.                                                        //
+//                                                                            //
+//  You should have received a copy of the GNU General Public License along   //
+//  with HP-Combi. If not, see <https://www.gnu.org/licenses/>.               //
+//****************************************************************************//
+
+// NOLINT(build/header_guard)
+
+/** @file
+@brief implementation of subset16.hpp ; this file should not be included
+directly.
+*/
+
+namespace HPCombi {
+
+inline Subset16::Subset16(std::initializer_list<uint8_t> elems) noexcept
+    : _bits(0) {
+    for (auto i : elems) {
+        HPCOMBI_ASSERT(i < 16);
+        _bits |= uint16_t(1) << i;
+    }
+}
+
+inline epu8 Subset16::to_gather() const noexcept {
+    uint8_t nlo = __builtin_popcount(_bits & 0xFF);
+    epu8 halves = simde_mm_set_epi64x(detail::bit_positions[_bits >> 8] |
+                                          0x0808080808080808ULL,
+                                      detail::bit_positions[_bits & 0xFF]);
+    // Move the high half right after the nlo elements of the low half. The
+    // indices which fall outside are past size() and replaced by 0xFF below.
+    epu8 idx = Epu8.id() + ((Epu8.id() >= Epu8(nlo)) & Epu8(uint8_t(8 - nlo)));
+    return permuted(halves, idx) | (Epu8.id() >= Epu8(uint8_t(size())));
+}
+
+inline size_t Subset16::rank() const noexcept {
+    size_t res = 0, i = 1;
+    for (auto c : *this)
+        res += detail::binomials[c][i++];
+    return res;
+}
+
+inline Subset16 Subset16::unrank(size_t k, size_t r) noexcept {
+    uint16_t bits = 0;
+    size_t c = 16;
+    for (size_t i = k; i > 0; i--) {
+        do {
+            c--;
+        } while (detail::binomials[c][i] > r);
+        bits |= uint16_t(1) << c;
+        r -= detail::binomials[c][i];
+    }
+    return Subset16(bits);
+}
+
+inline bool Subset16::next_colex(size_t n) noexcept {
+    uint32_t s = _bits;
+    if (s == 0)
+        return false;
+    uint32_t r = s + (s & -s);
+    s = (((r ^ s) >> 2) >> __builtin_ctz(s)) | r;
+    if (s >> n) {
+        *this = first(size());
+        return false;
+    }
+    _bits = s;
+    return true;
+}
+
+template <typename Fun>
+inline void Subset16::for_each_k_subset(size_t n, size_t k, Fun f) {
+    for (uint32_t s = (1u << k) - 1; s < (1u << n);) {
+        f(Subset16(uint16_t(s)));
+        if (k == 0)
+            break;
+        uint32_t r = s + (s & -s);
+        s = (((r ^ s) >> 2) >> __builtin_ctz(s)) | r;
+    }
+}
+
+}  // namespace HPCombi
+
+namespace std {
+
+inline std::ostream &operator<<(std::ostream &stream,
+                                HPCombi::Subset16 const &s) {
+    stream << "{";
+    bool first = true;
+    for (auto i : s) {
+        stream << (first ? "" : ", ") << unsigned(i);
+        first = false;
+    }
+    return stream << "}";
+}
+
+}  // namespace std
@@ -0,0 +1,131 @@
+//****************************************************************************//
+//    Copyright (C) 2018-2024 Finn Smith <fls3@st-andrews.ac.uk>              //
+//    Copyright (C) 2018-2024 James Mitchell <jdm3@st-andrews.ac.uk>          //
+//    Copyright (C) 2018-2024 Florent Hivert <Florent.Hivert@lisn.fr>,        //
+//                                                                            //
+//  This file is part of HP-Combi <https://github.com/libsemigroups/HPCombi>  //
+//                                                                            //
+//  HP-Combi is free software: you can redistribute it and/or modify it       //
+//  under the terms of the GNU General Public License as published by the     //
+//  Free Software Foundation, either version 3 of the License, or             //
+//  (at your option) any later version.                                       //
+//                                                                            //
+//  HP-Combi is distributed in the hope that it will be useful, but WITHOUT   //
+//  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or     //
+//  FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License      //
+//  for  more details.                                                        //
+//                                                                            //
+//  You should have received a copy of the GNU General Public License along   //
+//  with HP-Combi. If not, see <https://www.gnu.org/licenses/>.               //
+//****************************************************************************//
+
+/** @file
+@brief declaration of HPCombi::Tableau16 and of the
+Robinson-Schensted-Knuth correspondence */
+
+#ifndef HPCOMBI_TABLEAU16_HPP_
+#define HPCOMBI_TABLEAU16_HPP_
+
+#include <array>    // for array
+#include <cstddef>  // for size_t
+#include <cstdint>  // for uint8_t
+#include <ostream>  // for ostream
+#include <utility>  // for pair
+
+#include "debug.hpp"        // for HPCOMBI_ASSERT
+#include "epu8.hpp"         // for epu8, first_non_zero
+#include "partition16.hpp"  // for Partition16
+#include "perm16.hpp"       // for Perm16
+
+namespace HPCombi {
+
+/** Semistandard Young tableaux with at most 16 cells and entries in
+@f$\{0\dots 15\}@f$.
+
+Each row is stored in an #HPCombi::epu8 in increasing order, padded with
+0xFF, so that the row insertion of a letter is a single comparison with the
+row, whose #HPCombi::first_non_zero gives the bumped entry, and a blend.
+The shape is maintained along the insertions.
+*/
+class Tableau16 {
+ public:
+    //! The empty tableau
+    Tableau16() noexcept;
+
+    //! The row \p i of \c *this, padded with 0xFF
+    epu8 row(size_t i) const noexcept {
+        HPCOMBI_ASSERT(i < 16);
+        return _rows[i];
+    }
+
+    //! The entry in row \p i and column \p j, or 0xFF
+    uint8_t operator()(size_t i, size_t j) const noexcept {
+        HPCOMBI_ASSERT(i < 16 && j < 16);
+        return _rows[i][j];
+    }
+
+    //! The shape of \c *this
+    Partition16 shape() const noexcept { return _shape; }
+
+    //! The number of cells of \c *this
+    size_t size() const noexcept { return _shape.sum(); }
+
+    /** Row insert \p x in \c *this, that is Schensted's bumping, and return
+     * the row where a cell was added
+     * @details \p x bumps the first entry of the first row larger than it,
+     * which is inserted in the second row and so on. \c *this must have
+     * less than 16 cells.
+     */
+    size_t insert(uint8_t x) noexcept;
+
+    //! Add a cell containing \p x at the end of the row \p i
+    void append(size_t i, uint8_t x) noexcept;
+
+    //! Return whether \c *this is a well constructed object
+    bool validate() const;
+
+    bool operator==(Tableau16 const &other) const noexcept;
+    bool operator!=(Tableau16 const &other) const noexcept {
+        return !(*this == other);
+    }
+
+ private:
+    std::array<epu8, 16> _rows;
+    Partition16 _shape;
+};
+
+/** The Robinson-Schensted-Knuth correspondence
+ * @param w a word whose \p n first letters are in @f$\{0\dots 15\}@f$, eg
+ *    a #HPCombi::Perm16
+ * @param n the length of the word
+ * @returns the insertion tableau @f$P@f$ and the recording tableau
+ *    @f$Q@f$, which is standard
+ */
+inline std::pair<Tableau16, Tableau16> rsk(epu8 w, size_t n = 16) noexcept;
+
+/** The shape of the tableaux of #rsk of \p w; only the insertion tableau is
+ * computed */
+inline Partition16 rsk_shape(epu8 w, size_t n = 16) noexcept;
+
+/** The shapes of the tableaux of #rsk of \p n permutations
+ * @details Sets <tt>out[i]</tt> to the shape of <tt>ps[i]</tt>. Two
+ * permutations are inserted at the same time, to overlap their dependency
+ * chains.
+ */
+inline void rsk_shapes(Perm16 const *ps, size_t n,
+                       Partition16 *out) noexcept;
+
+/** The length of a longest weakly increasing subsequence of the \p n first
+ * letters of \p w, that is of a longest increasing subsequence for a
+ * permutation
+ * @details By Schensted's theorem, this is the length of the first row of
+ * #rsk_shape; only this row is computed, which is patience sorting on a
+ * single #HPCombi::epu8.
+ */
+inline size_t longest_increasing_subsequence(epu8 w, size_t n = 16) noexcept;
+
+}  // namespace HPCombi
+
+#include "tableau16_impl.hpp"
+
+#endif  // HPCOMBI_TABLEAU16_HPP_
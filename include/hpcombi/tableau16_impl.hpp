@@ -0,0 +1,146 @@
+//****************************************************************************//
+//    Copyright (C) 2018-2024 Finn Smith <fls3@st-andrews.ac.uk>              //
+//    Copyright (C) 2018-2024 James Mitchell <jdm3@st-andrews.ac.uk>          //
+//    Copyright (C) 2018-2024 Florent Hivert <Florent.Hivert@lisn.fr>,        //
+//                                                                            //
+//  This file is part of HP-Combi <https://github.com/libsemigroups/HPCombi>  //
+//                                                                            //
+//  HP-Combi is free software: you can redistribute it and/or modify it       //
+//  under the terms of the GNU General Public License as published by the     //
+//  Free Software Foundation, either version 3 of the License, or             //
+//  (at your option) any later version.                                       //
+//                                                                            //
+//  HP-Combi is distributed in the hope that it will be useful, but WITHOUT   //
+//  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or     //
+//  FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License      //
+//  for  more details.                                                        //
+//                                                                            //
+//  You should have received a copy of the GNU General Public License along   //
+//  with HP-Combi. If not, see <https://www.gnu.org/licenses/>.               //
+//****************************************************************************//
+
+// NOLINT(build/header_guard)
+
+/** @file
+@brief implementation of tableau16.hpp ; this file should not be included
+directly.
+*/
+
+namespace HPCombi {
+
+inline Tableau16::Tableau16() noexcept : _shape(epu8{}) {
+    _rows.fill(Epu8(0xFF));
+}
+
+inline size_t Tableau16::insert(uint8_t x) noexcept {
+    HPCOMBI_ASSERT(size() < 16);
+    HPCOMBI_ASSERT(x < 16);
+    size_t i = 0;
+    for (;; i++) {
+        epu8 &row = _rows[i];
+        // The padding is larger than x, so that pos is at most the length
+        size_t pos = first_non_zero(row > Epu8(x), 16);
+        uint8_t bumped = row[pos];
+        row = simde_mm_blendv_epi8(row, Epu8(x),
+                                   Epu8.id() == Epu8(uint8_t(pos)));
+        if (bumped == 0xFF)
+            break;
+        x = bumped;
+    }
+    _shape.v += Epu8(1) & (Epu8.id() == Epu8(uint8_t(i)));
+    return i;
+}
+
+inline void Tableau16::append(size_t i, uint8_t x) noexcept {
+    HPCOMBI_ASSERT(size() < 16);
+    HPCOMBI_ASSERT(i < 16 && (i == 0 || _shape[i] < _shape[i - 1]));
+    _rows[i] = simde_mm_blendv_epi8(_rows[i], Epu8(x),
+                                    Epu8.id() == Epu8(_shape[i]));
+    _shape.v += Epu8(1) & (Epu8.id() == Epu8(uint8_t(i)));
+}
+
+inline bool Tableau16::validate() const {
+    if (!_shape.validate())
+        return false;
+    for (size_t i = 0; i < 16; i++) {
+        for (size_t j = 0; j < 16; j++) {
+            uint8_t x = _rows[i][j];
+            if ((j < _shape[i]) != (x < 16))
+                return false;
+            if (j < _shape[i] && ((j > 0 && _rows[i][j - 1] > x) ||
+                                  (i > 0 && _rows[i - 1][j] >= x)))
+                return false;
+        }
+    }
+    return true;
+}
+
+inline bool Tableau16::operator==(Tableau16 const &other) const noexcept {
+    for (size_t i = 0; i < 16; i++)
+        if (not_equal(_rows[i], other._rows[i]))
+            return false;
+    return true;
+}
+
+inline std::pair<Tableau16, Tableau16> rsk(epu8 w, size_t n) noexcept {
+    HPCOMBI_ASSERT(n <= 16);
+    Tableau16 p, q;
+    for (size_t k = 0; k < n; k++)
+        q.append(p.insert(w[k]), k);
+    return {p, q};
+}
+
+inline Partition16 rsk_shape(epu8 w, size_t n) noexcept {
+    HPCOMBI_ASSERT(n <= 16);
+    Tableau16 p;
+    for (size_t k = 0; k < n; k++)
+        p.insert(w[k]);
+    return p.shape();
+}
+
+inline void rsk_shapes(Perm16 const *ps, size_t n, Partition16 *out) noexcept {
+    size_t i = 0;
+    for (; i + 2 <= n; i += 2) {
+        Tableau16 a, b;
+        for (size_t k = 0; k < 16; k++) {
+            a.insert(ps[i][k]);
+            b.insert(ps[i + 1][k]);
+        }
+        out[i] = a.shape();
+        out[i + 1] = b.shape();
+    }
+    if (i < n)
+        out[i] = rsk_shape(ps[i]);
+}
+
+inline size_t longest_increasing_subsequence(epu8 w, size_t n) noexcept {
+    HPCOMBI_ASSERT(n <= 16);
+    epu8 row = Epu8(0xFF);
+    for (size_t k = 0; k < n; k++) {
+        // The row is increasing, so that the entries larger than w[k] are
+        // the ones after the first of them
+        epu8 larger = row > Epu8(w[k]);
+        row = simde_mm_blendv_epi8(row, Epu8(w[k]),
+                                   larger & ~shifted_right(larger));
+    }
+    return __builtin_popcount(simde_mm_movemask_epi8(row != Epu8(0xFF)));
+}
+
+}  // namespace HPCombi
+
+namespace std {
+
+inline std::ostream &operator<<(std::ostream &stream,
+                                HPCombi::Tableau16 const &t) {
+    HPCombi::Partition16 shape = t.shape();
+    stream << "[";
+    for (size_t i = 0; i < 16 && shape[i] != 0; i++) {
+        stream << (i == 0 ? "[" : ", [");
+        for (size_t j = 0; j < shape[i]; j++)
+            stream << (j == 0 ? "" : ", ") << unsigned(t(i, j));
+        stream << "]";
+    }
+    return stream << "]";
+}
+
+}  // namespace std
@@ -0,0 +1,64 @@
+//****************************************************************************//
+//     Copyright (C) 2023-2024 Florent Hivert <Florent.Hivert@lisn.fr>,       //
+//                                                                            //
+//  This file is part of HP-Combi <https://github.com/libsemigroups/HPCombi>  //
+//                                                                            //
+//  HP-Combi is free software: you can redistribute it and/or modify it       //
+//  under the terms of the GNU General Public License as published by the     //
+//  Free Software Foundation, either version 3 of the License, or             //
+//  (at your option) any later version.                                       //
+//                                                                            //
+//  HP-Combi is distributed in the hope that it will be useful, but WITHOUT   //
+//  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or     //
+//  FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License      //
+//  for  more details.                                                        //
+//                                                                            //
+//  You should have received a copy of the GNU General Public License along   //
+//  with HP-Combi. If not, see <https://www.gnu.org/licenses/>.               //
+//****************************************************************************//
+
+/** @file
+@brief SIMD vector types other than HPCombi::epu8 and their factories
+
+These are the 256 and 512 bits vectors of bytes, and the vectors of 16 bits
+entries. Together with their HPCombi::TPUBuild factories, they give the
+same compile-time constants as HPCombi::Epu8 (identity, reversal, cycles,
+sorting network rounds...) to kernels working on wider vectors. The types
+are GCC vector extensions, so that they are usable without AVX; the
+compiler splits the operations when the target lacks the wide registers.
+*/
+
+#ifndef HPCOMBI_TPU_HPP_
+#define HPCOMBI_TPU_HPP_
+
+#include <cstdint>  // for uint8_t, uint16_t
+
+#include "builder.hpp"  // for TPUBuild
+
+namespace HPCombi {
+
+/// SIMD vector of 32 unsigned bytes (256 bits)
+using epu8_256 = uint8_t __attribute__((vector_size(32)));
+/// SIMD vector of 64 unsigned bytes (512 bits)
+using epu8_512 = uint8_t __attribute__((vector_size(64)));
+/// SIMD vector of 8 unsigned 16 bits entries (128 bits)
+using epu16 = uint16_t __attribute__((vector_size(16)));
+/// SIMD vector of 16 unsigned 16 bits entries (256 bits)
+using epu16_256 = uint16_t __attribute__((vector_size(32)));
+
+/** Factory object for type #HPCombi::epu8_256;
+ * see #HPCombi::TPUBuild for usage and capability */
+constexpr TPUBuild<epu8_256> Epu8_256{};
+/** Factory object for type #HPCombi::epu8_512;
+ * see #HPCombi::TPUBuild for usage and capability */
+constexpr TPUBuild<epu8_512> Epu8_512{};
+/** Factory object for type #HPCombi::epu16;
+ * see #HPCombi::TPUBuild for usage and capability */
+constexpr TPUBuild<epu16> Epu16{};
+/** Factory object for type #HPCombi::epu16_256;
+ * see #HPCombi::TPUBuild for usage and capability */
+constexpr TPUBuild<epu16_256> Epu16_256{};
+
+}  // namespace HPCombi
+
+#endif  // HPCOMBI_TPU_HPP_
@@ -0,0 +1,126 @@
+//****************************************************************************//
+//    Copyright (C) 2018-2024 Finn Smith <fls3@st-andrews.ac.uk>              //
+//    Copyright (C) 2018-2024 James Mitchell <jdm3@st-andrews.ac.uk>          //
+//    Copyright (C) 2018-2024 Florent Hivert <Florent.Hivert@lisn.fr>,        //
+//                                                                            //
+//  This file is part of HP-Combi <https://github.com/libsemigroups/HPCombi>  //
+//                                                                            //
+//  HP-Combi is free software: you can redistribute it and/or modify it       //
+//  under the terms of the GNU General Public License as published by the     //
+//  Free Software Foundation, either version 3 of the License, or             //
+//  (at your option) any later version.                                       //
+//                                                                            //
+//  HP-Combi is distributed in the hope that it will be useful, but WITHOUT   //
+//  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or     //
+//  FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License      //
+//  for  more details.                                                        //
+//                                                                            //
+//  You should have received a copy of the GNU General Public License along   //
+//  with HP-Combi. If not, see <https://www.gnu.org/licenses/>.               //
+//****************************************************************************//
+
+/** @file
+@brief declaration of HPCombi::Transf16Store */
+
+#ifndef HPCOMBI_TRANSF16_STORE_HPP_
+#define HPCOMBI_TRANSF16_STORE_HPP_
+
+#include <array>    // for array
+#include <cstddef>  // for size_t
+#include <cstdint>  // for uint64_t, uint32_t
+#include <utility>  // for swap
+#include <vector>   // for vector
+
+#include "debug.hpp"   // for HPCOMBI_ASSERT
+#include "hash.hpp"    // for hash_fast
+#include "perm16.hpp"  // for Transf16
+
+namespace HPCombi {
+
+/** A set of #HPCombi::Transf16 stratified by rank and image.
+
+The elements are stored in buckets indexed by their image, given as the bit
+set returned by #HPCombi::PTransf16::image_bitset; the buckets of a given
+rank are listed together. Each bucket holds the 64 bits compressed forms of
+its elements in a compact array, in insertion order, together with its own
+open addressing hash table of indices into this array.
+
+Compared to a single hash set of #HPCombi::Transf16, an element costs 8
+bytes plus 8 to 16 bytes of hash table, without any per element
+allocation. The queries by rank or by image only scan the relevant buckets,
+and each lookup probes a table of the size of its bucket rather than of
+the whole set.
+*/
+class Transf16Store {
+ public:
+    //! The empty store
+    Transf16Store();
+
+    /** Insert \p t, and return whether it was not already present
+     * @details The image of \p t is computed by
+     * #HPCombi::PTransf16::image_bitset. */
+    bool insert(Transf16 t) { return insert(t, t.image_bitset()); }
+
+    //! Insert \p t whose image is \p image; see #insert(Transf16)
+    bool insert(Transf16 t, uint32_t image);
+
+    //! Whether \p t belongs to \c *this
+    bool contains(Transf16 t) const;
+
+    //! The number of elements of \c *this
+    size_t size() const noexcept { return _size; }
+
+    //! The number of elements of \c *this of rank \p rank
+    size_t size_of_rank(size_t rank) const noexcept {
+        HPCOMBI_ASSERT(rank <= 16);
+        return _rank_sizes[rank];
+    }
+
+    //! The images of rank \p rank of the elements of \c *this, as bit sets
+    std::vector<uint32_t> const &images_of_rank(size_t rank) const noexcept {
+        HPCOMBI_ASSERT(rank <= 16);
+        return _images[rank];
+    }
+
+    /** The compressed forms of the elements of \c *this whose image is
+     * \p image, in the order of their insertion; see
+     * #HPCombi::Transf16::Transf16(uint64_t) to decompress them */
+    std::vector<uint64_t> const &of_image(uint32_t image) const noexcept;
+
+    //! The elements of \c *this of rank \p rank, decompressed
+    std::vector<Transf16> elements_of_rank(size_t rank) const;
+
+    /** The monoid generated by \p gens
+     * @details Breadth first search from the identity, by right
+     * multiplication by the generators. Since the image of
+     * @f$x g@f$ is included in that of @f$x@f$, and equal to it when
+     * @f$g@f$ is a permutation, the image is only computed for the
+     * products by the non invertible generators.
+     */
+    static Transf16Store generated(std::vector<Transf16> const &gens);
+
+ private:
+    struct Bucket {
+        std::vector<uint64_t> elems;
+        // 1 + the index in elems, or 0 for an empty slot
+        std::vector<uint32_t> slots;
+
+        size_t find(uint64_t x) const noexcept;
+        void grow();
+    };
+
+    static constexpr uint32_t no_bucket = ~uint32_t(0);
+
+    // Index in _buckets of the bucket of each image
+    std::vector<uint32_t> _bucket_of;
+    std::vector<Bucket> _buckets;
+    std::array<std::vector<uint32_t>, 17> _images;
+    std::array<size_t, 17> _rank_sizes;
+    size_t _size;
+};
+
+}  // namespace HPCombi
+
+#include "transf16_store_impl.hpp"
+
+#endif  // HPCOMBI_TRANSF16_STORE_HPP_
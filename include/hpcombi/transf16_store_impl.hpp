@@ -0,0 +1,124 @@
+//****************************************************************************//
+//    Copyright (C) 2018-2024 Finn Smith <fls3@st-andrews.ac.uk>              //
+//    Copyright (C) 2018-2024 James Mitchell <jdm3@st-andrews.ac.uk>          //
+//    Copyright (C) 2018-2024 Florent Hivert <Florent.Hivert@lisn.fr>,        //
+//                                                                            //
+//  This file is part of HP-Combi <https://github.com/libsemigroups/HPCombi>  //
+//                                                                            //
+//  HP-Combi is free software: you can redistribute it and/or modify it       //
+//  under the terms of the GNU General Public License as published by the     //
+//  Free Software Foundation, either version 3 of the License, or             //
+//  (at your option) any later version.                                       //
+//                                                                            //
+//  HP-Combi is distributed in the hope that it will be useful, but WITHOUT   //
+//  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or     //
+//  FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License      //
+//  for  more details.                                                        //
+//                                                                            //
+//  You should have received a copy of the GNU General Public License along   //
+//  with HP-Combi. If not, see <https://www.gnu.org/licenses/>.               //
+//****************************************************************************//
+
+// NOLINT(build/header_guard)
+
+/** @file
+@brief implementation of transf16_store.hpp ; this file should not be
+included directly.
+*/
+
+namespace HPCombi {
+
+inline Transf16Store::Transf16Store()
+    : _bucket_of(1 << 16, no_bucket), _buckets(), _images(), _rank_sizes(),
+      _size(0) {}
+
+inline size_t Transf16Store::Bucket::find(uint64_t x) const noexcept {
+    size_t const mask = slots.size() - 1;
+    for (size_t i = hash_fast(x) & mask;; i = (i + 1) & mask) {
+        uint32_t s = slots[i];
+        if (s == 0 || elems[s - 1] == x)
+            return i;
+    }
+}
+
+inline void Transf16Store::Bucket::grow() {
+    slots.assign(slots.empty() ? 8 : 2 * slots.size(), 0);
+    for (size_t i = 0; i < elems.size(); i++)
+        slots[find(elems[i])] = i + 1;
+}
+
+inline bool Transf16Store::insert(Transf16 t, uint32_t image) {
+    HPCOMBI_ASSERT(t.validate());
+    HPCOMBI_ASSERT(image == t.image_bitset());
+    uint32_t &idx = _bucket_of[image];
+    if (idx == no_bucket) {
+        idx = _buckets.size();
+        _buckets.emplace_back();
+        _buckets.back().grow();
+        _images[__builtin_popcount(image)].push_back(image);
+    }
+    Bucket &b = _buckets[idx];
+    uint64_t x = uint64_t(t);
+    size_t i = b.find(x);
+    if (b.slots[i] != 0)
+        return false;
+    b.elems.push_back(x);
+    if (2 * b.elems.size() > b.slots.size())
+        b.grow();
+    else
+        b.slots[i] = b.elems.size();
+    _rank_sizes[__builtin_popcount(image)]++;
+    _size++;
+    return true;
+}
+
+inline bool Transf16Store::contains(Transf16 t) const {
+    uint32_t idx = _bucket_of[t.image_bitset()];
+    if (idx == no_bucket)
+        return false;
+    Bucket const &b = _buckets[idx];
+    return b.slots[b.find(uint64_t(t))] != 0;
+}
+
+inline std::vector<uint64_t> const &
+Transf16Store::of_image(uint32_t image) const noexcept {
+    static std::vector<uint64_t> const empty;
+    HPCOMBI_ASSERT(image < (1 << 16));
+    uint32_t idx = _bucket_of[image];
+    return idx == no_bucket ? empty : _buckets[idx].elems;
+}
+
+inline std::vector<Transf16>
+Transf16Store::elements_of_rank(size_t rank) const {
+    std::vector<Transf16> res;
+    res.reserve(size_of_rank(rank));
+    for (uint32_t image : images_of_rank(rank))
+        for (uint64_t x : of_image(image))
+            res.push_back(Transf16(x));
+    return res;
+}
+
+inline Transf16Store
+Transf16Store::generated(std::vector<Transf16> const &gens) {
+    std::vector<bool> invertible;
+    for (auto const &g : gens)
+        invertible.push_back(g.rank() == 16);
+    Transf16Store res;
+    res.insert(Transf16::one());
+    std::vector<Transf16> todo{Transf16::one()}, newtodo;
+    while (!todo.empty()) {
+        newtodo.clear();
+        for (auto const &v : todo) {
+            uint32_t image = v.image_bitset();
+            for (size_t i = 0; i < gens.size(); i++) {
+                Transf16 el = v * gens[i];
+                if (res.insert(el, invertible[i] ? image : el.image_bitset()))
+                    newtodo.push_back(el);
+            }
+        }
+        std::swap(todo, newtodo);
+    }
+    return res;
+}
+
+}  // namespace HPCombi
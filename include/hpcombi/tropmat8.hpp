@@ -0,0 +1,247 @@
+//****************************************************************************//
+//     Copyright (C) 2023-2024 Florent Hivert <Florent.Hivert@lisn.fr>,       //
+//                                                                            //
+//  This file is part of HP-Combi <https://github.com/libsemigroups/HPCombi>  //
+//                                                                            //
+//  HP-Combi is free software: you can redistribute it and/or modify it       //
+//  under the terms of the GNU General Public License as published by the     //
+//  Free Software Foundation, either version 3 of the License, or             //
+//  (at your option) any later version.                                       //
+//                                                                            //
+//  HP-Combi is distributed in the hope that it will be useful, but WITHOUT   //
+//  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or     //
+//  FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License      //
+//  for  more details.                                                        //
+//                                                                            //
+//  You should have received a copy of the GNU General Public License along   //
+//  with HP-Combi. If not, see <https://www.gnu.org/licenses/>.               //
+//****************************************************************************//
+
+/** @file
+@brief declaration of HPCombi::TropMat8 and of the truncated tropical
+semirings HPCombi::MaxPlusTrunc and HPCombi::MinPlusTrunc */
+
+#ifndef HPCOMBI_TROPMAT8_HPP_
+#define HPCOMBI_TROPMAT8_HPP_
+
+#include <algorithm>   // for min, max
+#include <array>       // for array
+#include <cstddef>     // for size_t
+#include <cstdint>     // for uint8_t, uint64_t
+#include <functional>  // for hash
+#include <iomanip>     // for setw
+#include <ostream>     // for ostream
+#include <vector>      // for vector
+
+#include "debug.hpp"   // for HPCOMBI_ASSERT
+#include "epu8.hpp"    // for epu8, min, max, permuted, lex_compare
+#include "hash.hpp"    // for FastHash, hash_fast
+#include "power.hpp"   // for Monoid
+#include "random.hpp"  // for random_stream
+
+namespace HPCombi {
+
+/** The max-plus semiring truncated at \c Threshold
+ *
+ * The elements are @f$\{-\infty, 0, 1, \dots, t\}@f$ where @f$t@f$ is
+ * \c Threshold; the sum is the maximum and the product is the sum truncated
+ * at @f$t@f$. The entry @f$-\infty@f$ is stored as #infinity.
+ */
+template <uint8_t Threshold> struct MaxPlusTrunc {
+    static_assert(Threshold < 128, "the threshold must be less than 128");
+    //! The largest finite element
+    static constexpr uint8_t threshold = Threshold;
+    //! The encoding of @f$-\infty@f$, the zero of the semiring
+    static constexpr uint8_t infinity = 0xFF;
+    //! The zero of the semiring
+    static constexpr uint8_t zero = infinity;
+    //! The one of the semiring
+    static constexpr uint8_t one = 0;
+
+    //! The sum of two elements
+    static uint8_t plus(uint8_t a, uint8_t b) noexcept {
+        return a == infinity ? b : b == infinity ? a : std::max(a, b);
+    }
+    //! The product of two elements
+    static uint8_t prod(uint8_t a, uint8_t b) noexcept {
+        return (a == infinity || b == infinity) ? infinity
+                                                : std::min(a + b, +threshold);
+    }
+    //! Entrywise sum; adding one maps @f$-\infty@f$ to 0 for the maximum
+    static epu8 plus(epu8 a, epu8 b) noexcept {
+        return max(a + Epu8(1), b + Epu8(1)) - Epu8(1);
+    }
+    //! Entrywise product; the saturated sum keeps #infinity absorbing
+    static epu8 prod(epu8 a, epu8 b) noexcept {
+        epu8 s = simde_mm_adds_epu8(a, b);
+        return min(s, Epu8(threshold)) | (s == Epu8(infinity));
+    }
+};
+
+/** The min-plus semiring truncated at \c Threshold
+ *
+ * The elements are @f$\{0, 1, \dots, t, +\infty\}@f$ where @f$t@f$ is
+ * \c Threshold; the sum is the minimum and the product is the sum truncated
+ * at @f$t@f$. The entry @f$+\infty@f$ is stored as #infinity.
+ */
+template <uint8_t Threshold> struct MinPlusTrunc {
+    static_assert(Threshold < 128, "the threshold must be less than 128");
+    //! The largest finite element
+    static constexpr uint8_t threshold = Threshold;
+    //! The encoding of @f$+\infty@f$, the zero of the semiring
+    static constexpr uint8_t infinity = 0xFF;
+    //! The zero of the semiring
+    static constexpr uint8_t zero = infinity;
+    //! The one of the semiring
+    static constexpr uint8_t one = 0;
+
+    //! The sum of two elements
+    static uint8_t plus(uint8_t a, uint8_t b) noexcept {
+        return std::min(a, b);
+    }
+    //! The product of two elements
+    static uint8_t prod(uint8_t a, uint8_t b) noexcept {
+        return (a == infinity || b == infinity) ? infinity
+                                                : std::min(a + b, +threshold);
+    }
+    //! Entrywise sum
+    static epu8 plus(epu8 a, epu8 b) noexcept { return min(a, b); }
+    //! Entrywise product; the saturated sum keeps #infinity absorbing
+    static epu8 prod(epu8 a, epu8 b) noexcept {
+        epu8 s = simde_mm_adds_epu8(a, b);
+        return min(s, Epu8(threshold)) | (s == Epu8(infinity));
+    }
+};
+
+/** Matrices of dimension up to 8×8 over a small semiring, stored as 64
+bytes in four #HPCombi::epu8; this is the analogue of #HPCombi::BMat8 for
+the truncated tropical semirings #HPCombi::MaxPlusTrunc and
+#HPCombi::MinPlusTrunc.
+
+@tparam Semiring a semiring whose elements are bytes, with static members
+    \c zero, \c one, and \c plus and \c prod on both \c uint8_t and
+    #HPCombi::epu8.
+
+The register @f$r@f$ holds the rows @f$2r@f$ and @f$2r+1@f$. As for
+#HPCombi::BMat8 all the matrices are 8×8 internally; the entries not
+defined by the user are the zero of the semiring, which does not affect
+the products.
+
+@par Algorithm:
+The product computes two rows of the result per register: for each
+@f$k@f$ the entries @f$a_{ik}@f$ are broadcast along their row with a
+shuffle and multiplied entrywise with the row @f$k@f$ of the right
+operand, duplicated in both halves, before being summed in the
+accumulator. This is 32 multiply-and-add steps of a few instructions
+each, instead of 512 scalar ones.
+
+TropMat8 is a trivial class.
+*/
+template <class Semiring> class TropMat8 {
+ public:
+    //! The semiring of the entries
+    using semiring = Semiring;
+
+    //! A default constructor.
+    //!
+    //! This constructor gives no guarantees on what the matrix will contain.
+    TropMat8() noexcept = default;
+
+    //! A constructor from the four registers holding the rows
+    explicit TropMat8(std::array<epu8, 4> const &rows) noexcept
+        : _rows(rows) {}
+
+    //! A constructor.
+    //!
+    //! This constructor initializes a matrix where the rows of the matrix
+    //! are the vectors in \p mat, whose entries are either at most
+    //! the threshold or \c Semiring::zero.
+    explicit TropMat8(std::vector<std::vector<uint8_t>> const &mat);
+
+    //! The zero matrix, all of whose entries are \c Semiring::zero
+    static TropMat8 zero() noexcept {
+        return TropMat8({Epu8(Semiring::zero), Epu8(Semiring::zero),
+                         Epu8(Semiring::zero), Epu8(Semiring::zero)});
+    }
+
+    //! The identity of dimension \p dim
+    static TropMat8 one(size_t dim = 8) noexcept;
+
+    //! A random matrix of dimension \p dim whose entries are uniform among
+    //! the finite elements and \c Semiring::zero
+    static TropMat8 random(size_t dim = 8);
+
+    //! Returns \c true if \c this equals \p that.
+    bool operator==(TropMat8 const &that) const noexcept {
+        return lex_compare(_rows.data(), that._rows.data(), 4) == 0;
+    }
+    //! Returns \c true if \c this does not equal \p that
+    bool operator!=(TropMat8 const &that) const noexcept {
+        return !(*this == that);
+    }
+    //! Lexicographic comparison of the entries, row by row
+    bool operator<(TropMat8 const &that) const noexcept {
+        return lex_compare(_rows.data(), that._rows.data(), 4) < 0;
+    }
+
+    //! Returns the entry in the (\p i, \p j)th position.
+    uint8_t operator()(size_t i, size_t j) const noexcept {
+        HPCOMBI_ASSERT(i < 8 && j < 8);
+        return _rows[i / 2][8 * (i % 2) + j];
+    }
+    //! Sets the (\p i, \p j)th position to \p val.
+    void set(size_t i, size_t j, uint8_t val) noexcept {
+        HPCOMBI_ASSERT(i < 8 && j < 8);
+        _rows[i / 2][8 * (i % 2) + j] = val;
+    }
+
+    //! The four registers holding the rows
+    std::array<epu8, 4> const &rows() const noexcept { return _rows; }
+
+    //! Returns the matrix product of \c this and \p that
+    //!
+    //! See the class documentation for the algorithm.
+    TropMat8 operator*(TropMat8 const &that) const noexcept;
+    //! Same as #operator* with scalar operations.
+    TropMat8 mult_ref(TropMat8 const &that) const noexcept;
+
+    //! Returns the transpose of \c this
+    TropMat8 transpose() const noexcept;
+
+    //! Insertion of \c this into \p os; the zero of the semiring is
+    //! written \c *
+    std::ostream &write(std::ostream &os) const;
+
+ private:
+    std::array<epu8, 4> _rows;
+};
+
+/** Matrices over the max-plus semiring truncated at \c Threshold */
+template <uint8_t Threshold>
+using MaxPlusMat8 = TropMat8<MaxPlusTrunc<Threshold>>;
+/** Matrices over the min-plus semiring truncated at \c Threshold */
+template <uint8_t Threshold>
+using MinPlusMat8 = TropMat8<MinPlusTrunc<Threshold>>;
+
+//! The hash key of a #HPCombi::TropMat8 is a 64 bits digest of its rows
+template <class Semiring>
+inline uint64_t hash_key(TropMat8<Semiring> const &m) noexcept {
+    uint64_t res = 0;
+    for (epu8 r : m.rows())
+        res = hash_fast(res + hash_fast(r));
+    return res;
+}
+
+}  // namespace HPCombi
+
+#include "tropmat8_impl.hpp"
+
+namespace std {
+template <class Semiring> struct hash<HPCombi::TropMat8<Semiring>> {
+    inline size_t operator()(HPCombi::TropMat8<Semiring> const &m) const {
+        return HPCombi::FastHash<HPCombi::TropMat8<Semiring>>{}(m);
+    }
+};
+}  // namespace std
+
+#endif  // HPCOMBI_TROPMAT8_HPP_
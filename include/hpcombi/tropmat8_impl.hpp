@@ -0,0 +1,162 @@
+//****************************************************************************//
+//     Copyright (C) 2023-2024 Florent Hivert <Florent.Hivert@lisn.fr>,       //
+//                                                                            //
+//  This file is part of HP-Combi <https://github.com/libsemigroups/HPCombi>  //
+//                                                                            //
+//  HP-Combi is free software: you can redistribute it and/or modify it       //
+//  under the terms of the GNU General Public License as published by the     //
+//  Free Software Foundation, either version 3 of the License, or             //
+//  (at your option) any later version.                                       //
+//                                                                            //
+//  HP-Combi is distributed in the hope that it will be useful, but WITHOUT   //
+//  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or     //
+//  FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License      //
+//  for  more details.                                                        //
+//                                                                            //
+//  You should have received a copy of the GNU General Public License along   //
+//  with HP-Combi. If not, see <https://www.gnu.org/licenses/>.               //
+//****************************************************************************//
+
+// NOLINT(build/header_guard)
+
+/** @file
+@brief implementation of tropmat8.hpp ; this file should not be
+included directly.
+*/
+
+namespace HPCombi {
+
+namespace detail {
+
+// tropmat8_bcast[k] broadcasts the entry k of each of the two rows of a
+// register along its row
+inline constexpr std::array<epu8, 8> tropmat8_bcast = [] {
+    std::array<epu8, 8> res{};
+    for (size_t k = 0; k < 8; k++)
+        res[k] = Epu8([k](uint8_t i) { return uint8_t((i & 8) + k); });
+    return res;
+}();
+// tropmat8_dup[h] duplicates the row h of a register in both halves
+inline constexpr std::array<epu8, 2> tropmat8_dup = {
+    Epu8([](uint8_t i) { return i & 7; }),
+    Epu8([](uint8_t i) { return 8 + (i & 7); })};
+
+}  // namespace detail
+
+template <class Semiring>
+TropMat8<Semiring>::TropMat8(std::vector<std::vector<uint8_t>> const &mat)
+    : _rows(zero()._rows) {
+    HPCOMBI_ASSERT(mat.size() <= 8);
+    for (size_t i = 0; i < mat.size(); i++) {
+        HPCOMBI_ASSERT(mat[i].size() <= 8);
+        for (size_t j = 0; j < mat[i].size(); j++) {
+            HPCOMBI_ASSERT(mat[i][j] <= Semiring::threshold ||
+                           mat[i][j] == Semiring::zero);
+            set(i, j, mat[i][j]);
+        }
+    }
+}
+
+template <class Semiring>
+TropMat8<Semiring> TropMat8<Semiring>::one(size_t dim) noexcept {
+    HPCOMBI_ASSERT(dim <= 8);
+    TropMat8 res = zero();
+    for (size_t i = 0; i < dim; i++)
+        res.set(i, i, Semiring::one);
+    return res;
+}
+
+template <class Semiring>
+TropMat8<Semiring> TropMat8<Semiring>::random(size_t dim) {
+    HPCOMBI_ASSERT(dim <= 8);
+    TropMat8 res = zero();
+    for (size_t i = 0; i < dim; i++) {
+        for (size_t j = 0; j < dim; j++) {
+            uint8_t v = random_stream().below(Semiring::threshold + 2);
+            res.set(i, j, v > Semiring::threshold ? Semiring::zero : v);
+        }
+    }
+    return res;
+}
+
+template <class Semiring>
+TropMat8<Semiring>
+TropMat8<Semiring>::operator*(TropMat8 const &that) const noexcept {
+    std::array<epu8, 8> right;
+    for (size_t k = 0; k < 8; k++)
+        right[k] = permuted(that._rows[k / 2], detail::tropmat8_dup[k % 2]);
+    TropMat8 res;
+    for (size_t r = 0; r < 4; r++) {
+        epu8 acc = Epu8(Semiring::zero);
+        for (size_t k = 0; k < 8; k++) {
+            epu8 left = permuted(_rows[r], detail::tropmat8_bcast[k]);
+            acc = Semiring::plus(acc, Semiring::prod(left, right[k]));
+        }
+        res._rows[r] = acc;
+    }
+    return res;
+}
+
+template <class Semiring>
+TropMat8<Semiring>
+TropMat8<Semiring>::mult_ref(TropMat8 const &that) const noexcept {
+    TropMat8 res;
+    for (size_t i = 0; i < 8; i++) {
+        for (size_t j = 0; j < 8; j++) {
+            uint8_t acc = Semiring::zero;
+            for (size_t k = 0; k < 8; k++)
+                acc = Semiring::plus(
+                    acc, Semiring::prod((*this)(i, k), that(k, j)));
+            res.set(i, j, acc);
+        }
+    }
+    return res;
+}
+
+template <class Semiring>
+TropMat8<Semiring> TropMat8<Semiring>::transpose() const noexcept {
+    TropMat8 res;
+    for (size_t i = 0; i < 8; i++)
+        for (size_t j = 0; j < 8; j++)
+            res.set(j, i, (*this)(i, j));
+    return res;
+}
+
+template <class Semiring>
+std::ostream &TropMat8<Semiring>::write(std::ostream &os) const {
+    for (size_t i = 0; i < 8; ++i) {
+        for (size_t j = 0; j < 8; ++j) {
+            uint8_t x = (*this)(i, j);
+            if (x == Semiring::zero)
+                os << " *";
+            else
+                os << std::setw(2) << unsigned(x);
+        }
+        os << "\n";
+    }
+    return os;
+}
+
+namespace power_helper {
+
+template <class Semiring> struct Monoid<TropMat8<Semiring>> {
+    static const TropMat8<Semiring> one() { return TropMat8<Semiring>::one(); }
+    static TropMat8<Semiring> prod(TropMat8<Semiring> a,
+                                   TropMat8<Semiring> b) {
+        return a * b;
+    }
+};
+
+}  // namespace power_helper
+
+}  // namespace HPCombi
+
+namespace std {
+
+template <class Semiring>
+inline std::ostream &operator<<(std::ostream &os,
+                                HPCombi::TropMat8<Semiring> const &m) {
+    return m.write(os);
+}
+
+}  // namespace std
@@ -31,6 +31,7 @@
 #include <type_traits>       // for is_trivial
 
 #include "epu8.hpp"
+#include "hash.hpp"  // for FastHash
 
 namespace HPCombi {
 
@@ -109,6 +110,9 @@ struct alignas(16) Vect16 {
 
 static_assert(std::is_trivial<Vect16>(), "Vect16 is not a trivial class !");
 
+//! The hash key of a #HPCombi::Vect16; see #HPCombi::FastHash
+inline epu8 hash_key(Vect16 const &x) noexcept { return x.v; }
+
 }  // namespace HPCombi
 
 namespace std {
@@ -122,7 +126,7 @@ inline std::ostream &operator<<(std::ostream &stream,
 //! HPCombi::Vect16.
 template <> struct hash<HPCombi::Vect16> {
     size_t operator()(const HPCombi::Vect16 &ar) const {
-        return std::hash<HPCombi::epu8>{}(ar.v);
+        return HPCombi::FastHash<HPCombi::Vect16>{}(ar);
     }
 };
 
@@ -33,10 +33,11 @@
 #include <iomanip>           // for operator<<, setw
 #include <memory>            // for hash
 #include <ostream>           // for operator<<, basic_ostream
-#include <random>            // for mt19937, random_devide
-#include <type_traits>       // for is_trivial
+#include <type_traits>       // for is_integral, is_trivial
 
-#include "debug.hpp"  // for HPCOMBI_ASSERT
+#include "bytes.hpp"   // for first_diff, last_diff
+#include "debug.hpp"   // for HPCOMBI_ASSERT
+#include "random.hpp"  // for random_stream
 
 namespace HPCombi {
 
@@ -70,20 +71,37 @@ template <size_t Size, typename Expo = uint8_t> struct VectGeneric {
     Expo operator[](uint64_t i) const { return v[i]; }
     Expo &operator[](uint64_t i) { return v[i]; }
 
+    //! The entries seen as bytes, for the comparisons of bytes.hpp
+    uint8_t const *bytes() const {
+        return reinterpret_cast<uint8_t const *>(v.data());
+    }
+
     size_t first_diff(const VectGeneric &u, size_t bound = Size) const {
-        for (size_t i = 0; i < bound; i++)
-            if (v[i] != u[i])
-                return i;
-        return Size;
+        if constexpr (std::is_integral<Expo>::value) {
+            size_t diff = HPCombi::first_diff(bytes(), u.bytes(),
+                                              bound * sizeof(Expo));
+            return diff == bound * sizeof(Expo) ? Size : diff / sizeof(Expo);
+        } else {
+            for (size_t i = 0; i < bound; i++)
+                if (v[i] != u[i])
+                    return i;
+            return Size;
+        }
     }
 
     size_t last_diff(const VectGeneric &u, size_t bound = Size) const {
-        while (bound != 0) {
-            --bound;
-            if (u[bound] != v[bound])
-                return bound;
+        if constexpr (std::is_integral<Expo>::value) {
+            size_t diff = HPCombi::last_diff(bytes(), u.bytes(),
+                                             bound * sizeof(Expo));
+            return diff == bound * sizeof(Expo) ? Size : diff / sizeof(Expo);
+        } else {
+            while (bound != 0) {
+                --bound;
+                if (u[bound] != v[bound])
+                    return bound;
+            }
+            return Size;
         }
-        return Size;
     }
 
     using value_type = Expo;
@@ -130,11 +148,8 @@ template <size_t Size, typename Expo = uint8_t> struct VectGeneric {
     }
 
     static VectGeneric random() {
-        static std::random_device rd;
-        static std::mt19937 g(rd());
-
         VectGeneric<Size, Expo> res = VectGeneric<Size, Expo>(0, 0);
-        std::shuffle(res.begin(), res.end(), g);
+        std::shuffle(res.begin(), res.end(), random_stream());
         return res;
     }
 
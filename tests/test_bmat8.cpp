@@ -17,12 +17,13 @@
 //  with HP-Combi. If not, see <https://www.gnu.org/licenses/>.               //
 //****************************************************************************//
 
-#include <cstddef>   // for size_t
-#include <cstdint>   // for uint64_t
-#include <iostream>  // for char_traits, ostream, ostrin...
-#include <string>    // for operator==
-#include <utility>   // for pair
-#include <vector>    // for vector, allocator
+#include <algorithm>  // for any_of
+#include <cstddef>    // for size_t
+#include <cstdint>    // for uint64_t
+#include <iostream>   // for char_traits, ostream, ostrin...
+#include <string>     // for operator==
+#include <utility>    // for pair
+#include <vector>     // for vector, allocator
 
 #include "test_main.hpp"                 // for TEST_AGREES, TEST_AGREES2
 #include <catch2/catch_test_macros.hpp>  // for operator""_catch_sr, operator==
@@ -82,6 +83,18 @@ struct BMat8Fixture {
           BMlist(
               {zero, one1, one2, ones, bm, bm1, bmm1, bm2, bm2t, bm3, bm3t}) {}
 };
+
+// The matrices of dimension dim, in the top left corner
+std::vector<BMat8> all_bmat8(size_t dim) {
+    std::vector<BMat8> res;
+    for (uint64_t i = 0; i < (uint64_t(1) << (dim * dim)); i++) {
+        uint64_t x = 0;
+        for (size_t r = 0; r < dim; r++)
+            x |= ((i >> (dim * r)) & ((1 << dim) - 1)) << (64 - dim - 8 * r);
+        res.push_back(BMat8(x));
+    }
+    return res;
+}
 }  // namespace
 
 //****************************************************************************//
@@ -553,4 +566,106 @@ TEST_CASE("BMat8::right_perm_action_on_basis_ref", "[BMat8][026]") {
     CHECK(m1.right_perm_action_on_basis(m2) == Perm16({2, 0, 3, 1}));
 }
 
+TEST_CASE_METHOD(BMat8Fixture, "BMat8::row_space_included_many",
+                 "[BMat8][027]") {
+    std::vector<BMat8> sample(BMlist.begin(), BMlist.end());
+    for (size_t i = 0; i < 60; i++)
+        sample.push_back(BMat8::random(1 + i % 8, 0.3));
+    // products have a row space included in the one of the right factor
+    for (size_t i = 0; i < 60; i++)
+        sample.push_back(BMat8::random(8, 0.2) * sample[i]);
+    size_t words = (sample.size() + 63) / 64;
+    for (size_t n : {size_t(0), size_t(1), size_t(3), size_t(5), size_t(64),
+                     sample.size()}) {
+        for (auto x : sample) {
+            std::vector<uint64_t> out(words, ~uint64_t(0));
+            BMat8::row_space_included_many(x, sample.data(), n, out.data());
+            for (size_t j = 0; j < (n + 63) / 64 * 64; j++) {
+                bool expected = j < n && x.row_space_included(sample[j]);
+                CHECK(((out[j / 64] >> (j % 64)) & 1) == expected);
+            }
+            out.assign(words, ~uint64_t(0));
+            BMat8::row_space_included_many(sample.data(), n, x, out.data());
+            for (size_t j = 0; j < (n + 63) / 64 * 64; j++) {
+                bool expected = j < n && sample[j].row_space_included(x);
+                CHECK(((out[j / 64] >> (j % 64)) & 1) == expected);
+            }
+        }
+    }
+}
+
+TEST_CASE_METHOD(BMat8Fixture, "BMat8::invariants", "[BMat8][028]") {
+    std::vector<BMat8> sample(BMlist.begin(), BMlist.end());
+    for (size_t i = 0; i < 500; i++)
+        sample.push_back(BMat8::random(1 + i % 8, 0.1 + 0.1 * (i % 8)));
+    for (auto x : sample) {
+        auto inv = x.invariants();
+        CHECK(inv.row_space_size == x.row_space_size());
+        CHECK(inv.col_space_size == x.transpose().row_space_size());
+        CHECK(inv.nr_rows == x.nr_rows());
+        CHECK(inv.nr_cols == x.transpose().nr_rows());
+        CHECK(inv.row_space_basis == x.row_space_basis());
+        CHECK(inv.col_space_basis == x.col_space_basis());
+        epu8 rows{}, cols{};
+        for (size_t i = 0; i < 8; i++) {
+            for (size_t j = 0; j < 8; j++) {
+                rows[i] += x(i, j);
+                cols[j] += x(i, j);
+            }
+        }
+        CHECK_THAT(inv.row_popcounts, Equals(sorted8(rows)));
+        CHECK_THAT(inv.col_popcounts, Equals(sorted8(cols)));
+    }
+}
+
+TEST_CASE_METHOD(BMat8Fixture, "BMat8::is_idempotent", "[BMat8][029]") {
+    std::vector<BMat8> sample = all_bmat8(3);
+    sample.insert(sample.end(), BMlist.begin(), BMlist.end());
+    for (size_t i = 0; i < 500; i++) {
+        BMat8 x = BMat8::random(1 + i % 8, 0.1 + 0.1 * (i % 8));
+        sample.push_back(x);
+        sample.push_back(x.row_space_basis() * BMat8::one(i % 8));
+        sample.push_back(
+            BMat8(BMat8::one(i % 8).to_int() | (x * x.transpose()).to_int()));
+    }
+    size_t nr_idempotents = 0;
+    for (auto x : sample) {
+        CHECK(x.is_idempotent() == (x * x == x));
+        nr_idempotents += x.is_idempotent();
+    }
+    CHECK(nr_idempotents > sample.size() / 10);
+    std::vector<uint64_t> out((sample.size() + 63) / 64);
+    for (size_t n : {size_t(0), size_t(3), size_t(65), sample.size()}) {
+        out.assign(out.size(), ~uint64_t(0));
+        BMat8::is_idempotent_many(sample.data(), n, out.data());
+        for (size_t j = 0; j < (n + 63) / 64 * 64; j++) {
+            bool expected = j < n && sample[j].is_idempotent();
+            CHECK(((out[j / 64] >> (j % 64)) & 1) == expected);
+        }
+    }
+}
+
+TEST_CASE("BMat8::is_regular_element", "[BMat8][030]") {
+    std::vector<BMat8> const all3 = all_bmat8(3);
+    size_t nr_regular = 0;
+    for (auto x : all3) {
+        bool expected = std::any_of(all3.begin(), all3.end(),
+                                    [x](BMat8 y) { return x * y * x == x; });
+        CHECK(x.is_regular_element() == expected);
+        nr_regular += expected;
+    }
+    CHECK(nr_regular < all3.size());
+    std::vector<BMat8> const all4 = all_bmat8(4);
+    for (size_t i = 0; i < 20; i++) {
+        BMat8 x = BMat8::random(4);
+        bool expected = std::any_of(all4.begin(), all4.end(),
+                                    [x](BMat8 y) { return x * y * x == x; });
+        CHECK(x.is_regular_element() == expected);
+    }
+    for (size_t i = 0; i < 100; i++) {
+        BMat8 x = BMat8::random(1 + i % 8);
+        CHECK(x.is_idempotent() <= x.is_regular_element());
+    }
+}
+
 }  // namespace HPCombi
@@ -0,0 +1,105 @@
+//****************************************************************************//
+//    Copyright (C) 2018-2024 Finn Smith <fls3@st-andrews.ac.uk>              //
+//    Copyright (C) 2018-2024 James Mitchell <jdm3@st-andrews.ac.uk>          //
+//    Copyright (C) 2018-2024 Florent Hivert <Florent.Hivert@lisn.fr>,        //
+//                                                                            //
+//  This file is part of HP-Combi <https://github.com/libsemigroups/HPCombi>  //
+//                                                                            //
+//  HP-Combi is free software: you can redistribute it and/or modify it       //
+//  under the terms of the GNU General Public License as published by the     //
+//  Free Software Foundation, either version 3 of the License, or             //
+//  (at your option) any later version.                                       //
+//                                                                            //
+//  HP-Combi is distributed in the hope that it will be useful, but WITHOUT   //
+//  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or     //
+//  FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License      //
+//  for  more details.                                                        //
+//                                                                            //
+//  You should have received a copy of the GNU General Public License along   //
+//  with HP-Combi. If not, see <https://www.gnu.org/licenses/>.               //
+//****************************************************************************//
+
+#include <cstddef>  // for size_t
+#include <cstdint>  // for uint64_t
+#include <mutex>    // for mutex, lock_guard
+#include <set>      // for set
+#include <vector>   // for vector
+
+#include "test_main.hpp"                 // for TEST_AGREES
+#include <catch2/catch_test_macros.hpp>  // for operator""_catch_sr, operator==
+
+#include "hpcombi/bmat8.hpp"         // for BMat8
+#include "hpcombi/bmat8_orbits.hpp"  // for BMat8Orbits
+#include "hpcombi/perm16.hpp"        // for Perm16
+
+namespace HPCombi {
+
+TEST_CASE("BMat8Orbits::count", "[BMat8Orbits][000]") {
+    // OEIS A002724
+    std::vector<uint64_t> const expected{2, 7, 36, 317, 5624};
+    for (size_t dim = 1; dim <= 5; ++dim) {
+        CHECK(BMat8Orbits(dim).count() == expected[dim - 1]);
+    }
+}
+
+// The matrix of dimension dim whose entries are the bits of i
+BMat8 corner_matrix(uint64_t i, size_t dim) {
+    uint64_t res = 0;
+    for (size_t k = 0; k < dim * dim; ++k)
+        if ((i >> k) & 1)
+            res |= uint64_t(1) << (63 - 8 * (k / dim) - k % dim);
+    return BMat8(res);
+}
+
+TEST_CASE("BMat8Orbits::all", "[BMat8Orbits][001]") {
+    for (size_t dim = 1; dim <= 4; ++dim) {
+        BMat8Orbits orbits(dim);
+        std::set<BMat8> canon;
+        for (uint64_t i = 0; i < (uint64_t(1) << (dim * dim)); ++i)
+            canon.insert(orbits.canonical(corner_matrix(i, dim)));
+        auto all = orbits.all();
+        CHECK(std::vector<BMat8>(canon.begin(), canon.end()) == all);
+        for (auto x : all) {
+            CHECK(orbits.is_canonical(x));
+            CHECK(x.transpose() == BMat8::one(dim) * x.transpose());
+        }
+    }
+}
+
+TEST_CASE("BMat8Orbits::canonical", "[BMat8Orbits][002]") {
+    for (size_t dim = 1; dim <= 8; ++dim) {
+        BMat8Orbits orbits(dim);
+        for (size_t i = 0; i < 100; ++i) {
+            BMat8 x = BMat8::random(dim);
+            BMat8 c = orbits.canonical(x);
+            CHECK(orbits.is_canonical(c));
+            CHECK(c.row_space_size() == x.row_space_size());
+            Perm16 p = Perm16::random(dim), q = Perm16::random(dim);
+            CHECK(orbits.canonical(x.row_permuted(p).col_permuted(q)) == c);
+            CHECK(x.to_int() <= c.to_int());
+            CHECK(orbits.is_canonical(x) == (x == c));
+        }
+    }
+}
+
+TEST_CASE("BMat8Orbits::for_each_batch", "[BMat8Orbits][003]") {
+    BMat8Orbits orbits(5);
+    auto const all = orbits.all(1);
+    for (size_t nr_threads : {1, 2, 4}) {
+        std::set<BMat8> seen;
+        std::mutex mtx;
+        size_t nr_batches = 0;
+        orbits.for_each_batch(
+            [&](std::vector<BMat8> const &batch) {
+                std::lock_guard<std::mutex> lock(mtx);
+                CHECK(batch.size() <= 100);
+                seen.insert(batch.begin(), batch.end());
+                nr_batches++;
+            },
+            nr_threads, 100);
+        CHECK(std::vector<BMat8>(seen.begin(), seen.end()) == all);
+        CHECK(nr_batches >= all.size() / 100);
+    }
+}
+
+}  // namespace HPCombi
@@ -17,6 +17,7 @@
 //  with HP-Combi. If not, see <https://www.gnu.org/licenses/>.               //
 //****************************************************************************//
 
+#include <algorithm>
 #include <iostream>
 #include <vector>
 
@@ -25,6 +26,7 @@
 #include <catch2/matchers/catch_matchers_predicate.hpp>
 
 #include "hpcombi/epu8.hpp"
+#include "hpcombi/tpu.hpp"
 
 namespace HPCombi {
 
@@ -760,4 +762,248 @@ TEST_CASE_METHOD(Fix, "is_permutation_eval", "[Epu8][069]") {
     }
 }
 
+TEST_CASE_METHOD(Fix, "mask_from_bitset", "[Epu8][070]") {
+    CHECK_THAT(mask_from_bitset(0), Equals(zero));
+    CHECK_THAT(mask_from_bitset(0xFFFF), Equals(Epu8(0xFF)));
+    CHECK_THAT(mask_from_bitset(0b1001), Equals(Epu8({0xFF, 0, 0, 0xFF}, 0)));
+    for (uint32_t bits = 0; bits < 0x10000; bits += 7)
+        CHECK(uint32_t(simde_mm_movemask_epi8(mask_from_bitset(bits))) == bits);
+    for (auto x : v) {
+        epu8 mask = x < Epu8(6);
+        CHECK_THAT(mask_from_bitset(simde_mm_movemask_epi8(mask)),
+                   Equals(mask));
+    }
+}
+
+TEST_CASE_METHOD(Fix, "Epu8::sorted(epu8x2)", "[Epu8][071]") {
+    for (auto x : v) {
+        for (auto y : v) {
+            epu8x2 res = sorted(epu8x2{x, y});
+            std::array<uint8_t, 32> ref;
+            std::copy(as_array(x).begin(), as_array(x).end(), ref.begin());
+            std::copy(as_array(y).begin(), as_array(y).end(), ref.begin() + 16);
+            std::sort(ref.begin(), ref.end());
+            for (size_t i = 0; i < 32; i++)
+                CHECK(res[i / 16][i % 16] == ref[i]);
+        }
+    }
+}
+
+TEST_CASE_METHOD(Fix, "Epu8::sort_blocks", "[Epu8][072]") {
+    for (size_t n : {0, 1, 2, 3, 4, 5, 7, 8, 11, 16, 18}) {
+        std::vector<epu8> blocks;
+        for (size_t i = 0; i < n; i++)
+            blocks.push_back(i < v.size() ? v[i] : random_epu8(256));
+        std::vector<uint8_t> ref;
+        for (auto x : blocks)
+            ref.insert(ref.end(), as_array(x).begin(), as_array(x).end());
+        std::sort(ref.begin(), ref.end());
+        sort_blocks(blocks.data(), n);
+        for (size_t i = 0; i < 16 * n; i++)
+            CHECK(blocks[i / 16][i % 16] == ref[i]);
+    }
+    std::array<epu8, 4> arr{Epu8.rev(), Pc, zero, RP};
+    auto res = sorted(arr);
+    for (size_t i = 1; i < 64; i++)
+        CHECK(res[(i - 1) / 16][(i - 1) % 16] <= res[i / 16][i % 16]);
+}
+
+TEST_CASE_METHOD(Fix, "Epu8::sort_by_key", "[Epu8][073]") {
+    for (auto x : v) {
+        epu8 keys = x, values = Epu8.id();
+        sort_by_key(keys, values);
+        CHECK_THAT(keys, Equals(sorted(x)));
+        CHECK(is_permutation(values));
+        CHECK_THAT(permuted(x, values), Equals(keys));
+        for (auto y : v) {
+            keys = x;
+            values = y;
+            sort_by_key(keys, values);
+            CHECK_THAT(keys, Equals(sorted(x)));
+            // The multiset of pairs (key, value) is unchanged
+            std::vector<std::pair<uint8_t, uint8_t>> before, after;
+            for (size_t i = 0; i < 16; i++) {
+                before.emplace_back(x[i], y[i]);
+                after.emplace_back(keys[i], values[i]);
+            }
+            std::sort(before.begin(), before.end());
+            std::sort(after.begin(), after.end());
+            CHECK(before == after);
+        }
+    }
+}
+
+TEST_CASE_METHOD(Fix, "Epu8::sorted_bounded", "[Epu8][074]") {
+    for (auto x : v) {
+        epu8 y = x & Epu8(0x0F);
+        CHECK_THAT(sorted_count<16>(y), Equals(sorted(y)));
+        CHECK_THAT(sorted_bounded<16>(y), Equals(sorted(y)));
+        y = x & Epu8(0x03);
+        CHECK_THAT(sorted_count<4>(y), Equals(sorted(y)));
+        CHECK_THAT(sorted_bounded<4>(y), Equals(sorted(y)));
+        CHECK_THAT(sorted_count<1>(y & zero), Equals(zero));
+    }
+    for (size_t i = 0; i < 100; i++) {
+        epu8 x = random_epu8(5);
+        CHECK_THAT(sorted_count<5>(x), Equals(sorted(x)));
+        CHECK_THAT(sorted_count<7>(x), Equals(sorted(x)));
+        x = random_epu8(2);
+        CHECK_THAT(sorted_bounded<2>(x), Equals(sorted(x)));
+    }
+}
+
+TEST_CASE_METHOD(Fix, "Epu8::multiset", "[Epu8][075]") {
+    for (auto x : v) {
+        for (auto y : v) {
+            epu8 ex = eval16(x), ey = eval16(y);
+            epu8 uni = multiset_union(ex, ey),
+                 inter = multiset_intersection(ex, ey),
+                 sum = multiset_sum(ex, ey), diff = multiset_difference(ex, ey);
+            for (size_t i = 0; i < 16; i++) {
+                CHECK(uni[i] == std::max(ex[i], ey[i]));
+                CHECK(inter[i] == std::min(ex[i], ey[i]));
+                CHECK(sum[i] == ex[i] + ey[i]);
+                CHECK(diff[i] == (ex[i] > ey[i] ? ex[i] - ey[i] : 0));
+            }
+            CHECK(is_submultiset(inter, ex));
+            CHECK(is_submultiset(ex, uni));
+            CHECK(is_submultiset(ex, ey) == equal(inter, ex));
+            CHECK(same_content(x, y) == equal(sorted(x), sorted(y)));
+        }
+        CHECK(same_content(x, permuted(x, RP)));
+        CHECK(same_content(x, reverted(x)));
+    }
+    CHECK(!same_content(Pc, Pc + Epu8(16)));
+    CHECK(equal(multiset_sum(Epu8(200), Epu8(100)), Epu8(255)));
+}
+
+TEST_CASE_METHOD(Fix, "Epu8::histogram", "[Epu8][076]") {
+    CHECK(histogram(nullptr, 0) == std::array<uint64_t, 16>{});
+    for (size_t n : {1, 14, 15, 16, 100, 3840, 3841, 10000}) {
+        std::vector<epu8> words;
+        for (size_t i = 0; i < n; i++)
+            words.push_back(i < v.size() ? v[i] : random_epu8(20));
+        std::array<uint64_t, 16> ref{};
+        for (auto w : words)
+            for (size_t j = 0; j < 16; j++)
+                if (w[j] < 16)
+                    ref[w[j]]++;
+        CHECK(histogram(words.data(), n) == ref);
+    }
+    // Worst case for the counters: all the entries are equal
+    std::vector<epu8> zeros(70000, zero);
+    auto res = histogram(zeros.data(), zeros.size());
+    CHECK(res[0] == 16 * 70000);
+    CHECK(res[1] == 0);
+}
+
+TEST_CASE("Epu8::first_diff_array", "[Epu8][077]") {
+    for (size_t n : {0, 1, 15, 16, 17, 63, 64, 65, 130, 200}) {
+        std::vector<uint8_t> a(n), b;
+        for (auto &x : a)
+            x = random_stream().below(4);
+        // no difference, then a difference at each position
+        for (size_t d = 0; d <= n; d++) {
+            b = a;
+            if (d < n)
+                b[d] ^= 1 + random_stream().below(255);
+            size_t ref = std::mismatch(a.begin(), a.end(), b.begin()).first -
+                         a.begin();
+            CHECK(first_diff(a.data(), b.data(), n) == ref);
+            CHECK(last_diff(a.data(), b.data(), n) == ref);
+            int cmp = lex_compare(a.data(), b.data(), n);
+            CHECK((cmp < 0) == std::lexicographical_compare(
+                                   a.begin(), a.end(), b.begin(), b.end()));
+            CHECK((cmp == 0) == (d == n));
+        }
+        // two differences
+        if (n >= 2) {
+            b = a;
+            b[n / 3] ^= 1;
+            b[n - 1] ^= 1;
+            CHECK(first_diff(a.data(), b.data(), n) == n / 3);
+            CHECK(last_diff(a.data(), b.data(), n) == n - 1);
+        }
+    }
+}
+
+TEST_CASE_METHOD(Fix, "Epu8::lex_compare_array", "[Epu8][078]") {
+    std::vector<epu8> w(v.begin(), v.end());
+    for (size_t i = 0; i < w.size(); i++) {
+        std::vector<epu8> u = w;
+        u[i] = u[i] ^ Epu8(1);
+        size_t diff = first_diff(w.data(), u.data(), w.size());
+        CHECK(diff == 16 * i + first_diff(w[i], u[i]));
+        CHECK((lex_compare(w.data(), u.data(), w.size()) < 0) ==
+              less(w[i], u[i]));
+    }
+    CHECK(first_diff(w.data(), w.data(), w.size()) == 16 * w.size());
+    CHECK(lex_compare(w.data(), w.data(), w.size()) == 0);
+}
+
+// Apply a sorting network entry by entry
+template <class TPU, size_t N>
+TPU apply_network(TPU v, std::array<TPU, N> const &rounds) {
+    auto a = as_array(v);
+    for (TPU round : rounds) {
+        auto r = as_array(round);
+        auto b = a;
+        for (size_t i = 0; i < a.size(); i++)
+            b[i] = i < r[i] ? std::min(a[i], a[r[i]]) : std::max(a[i], a[r[i]]);
+        a = b;
+    }
+    return TPUBuild<TPU>()(a);
+}
+
+template <class TPU> void check_tpu_build() {
+    constexpr TPUBuild<TPU> build{};
+    constexpr size_t n = build.size;
+    constexpr TPU id = build.id(), rev = build.rev();
+    constexpr TPU lcycle = build.left_cycle(), rcycle = build.right_cycle();
+    constexpr TPU ldup = build.left_dup(), rdup = build.right_dup();
+    constexpr TPU pop = build.popcount();
+    constexpr auto rounds = build.sorting_rounds();
+    for (size_t i = 0; i < n; i++) {
+        CHECK(id[i] == i);
+        CHECK(rev[i] == n - 1 - i);
+        CHECK(lcycle[i] == (i + n - 1) % n);
+        CHECK(rcycle[i] == (i + 1) % n);
+        CHECK(ldup[i] == std::min(i + 1, n - 1));
+        CHECK(rdup[i] == (i == 0 ? 0 : i - 1));
+        CHECK(pop[i] == size_t(__builtin_popcount(i)));
+    }
+    // Each round is an involution
+    for (TPU round : rounds)
+        for (size_t i = 0; i < n; i++)
+            CHECK(as_array(round)[as_array(round)[i]] == i);
+    for (size_t t = 0; t < 100; t++) {
+        auto a = as_array(build(0));
+        for (auto &x : a)
+            x = random_stream().below(3 * n);
+        auto res = as_array(apply_network(build(a), rounds));
+        std::sort(a.begin(), a.end());
+        CHECK(res == a);
+    }
+}
+
+TEST_CASE("TPUBuild::wider_types", "[Epu8][079]") {
+    check_tpu_build<epu8>();
+    check_tpu_build<epu8_256>();
+    check_tpu_build<epu8_512>();
+    check_tpu_build<epu16>();
+    check_tpu_build<epu16_256>();
+    CHECK(Epu8.nb_sorting_rounds == 10);
+    CHECK(Epu8_512.nb_sorting_rounds == 21);
+    CHECK(Epu16.nb_sorting_rounds == 6);
+}
+
+TEST_CASE_METHOD(Fix, "Epu8::sorting_rounds_builder", "[Epu8][080]") {
+    for (auto x : v) {
+        CHECK_THAT(network_sort<true>(x, Epu8.sorting_rounds()),
+                   Equals(sorted(x)));
+        CHECK_THAT(network_sort<false>(x, Epu8.sorting_rounds()),
+                   Equals(revsorted(x)));
+    }
+}
+
 }  // namespace HPCombi
@@ -0,0 +1,118 @@
+//****************************************************************************//
+//     Copyright (C) 2016-2024 Florent Hivert <Florent.Hivert@lisn.fr>,       //
+//                                                                            //
+//  This file is part of HP-Combi <https://github.com/libsemigroups/HPCombi>  //
+//                                                                            //
+//  HP-Combi is free software: you can redistribute it and/or modify it       //
+//  under the terms of the GNU General Public License as published by the     //
+//  Free Software Foundation, either version 3 of the License, or             //
+//  (at your option) any later version.                                       //
+//                                                                            //
+//  HP-Combi is distributed in the hope that it will be useful, but WITHOUT   //
+//  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or     //
+//  FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License      //
+//  for  more details.                                                        //
+//                                                                            //
+//  You should have received a copy of the GNU General Public License along   //
+//  with HP-Combi. If not, see <https://www.gnu.org/licenses/>.               //
+//****************************************************************************//
+
+#include <algorithm>      // for next_permutation
+#include <cstddef>        // for size_t
+#include <cstdint>        // for uint64_t
+#include <unordered_set>  // for unordered_set
+#include <vector>         // for vector
+
+#include "test_main.hpp"                 // for TEST_AGREES
+#include <catch2/catch_test_macros.hpp>  // for operator""_catch_sr, operator==
+
+#include "hpcombi/bmat8.hpp"     // for BMat8
+#include "hpcombi/hash.hpp"      // for FastHash, StrongHash, hash_many
+#include "hpcombi/perm16.hpp"    // for Perm16, Transf16
+#include "hpcombi/subset16.hpp"  // for Subset16
+
+namespace HPCombi {
+namespace {
+
+std::vector<Perm16> all_perms(size_t n) {
+    std::vector<Perm16> res;
+    Perm16 p = Perm16::one();
+    do {
+        res.push_back(p);
+    } while (std::next_permutation(p.begin(), p.begin() + n));
+    return res;
+}
+
+template <typename T, typename Hasher>
+void check_hash_many(std::vector<T> const &keys) {
+    std::vector<uint64_t> out(keys.size());
+    hash_many<T, Hasher>(keys.data(), keys.size(), out.data());
+    for (size_t i = 0; i < keys.size(); i++)
+        CHECK(out[i] == Hasher()(keys[i]));
+}
+
+}  // namespace
+
+TEST_CASE("Hash::std_hash_is_fast_hash", "[Hash][000]") {
+    for (auto p : all_perms(5)) {
+        CHECK(std::hash<Perm16>()(p) == FastHash<Perm16>()(p));
+        CHECK(std::hash<Perm16>()(p) == hash_fast(uint64_t(p)));
+        CHECK(std::hash<Transf16>()(p) == std::hash<Perm16>()(p));
+        CHECK(std::hash<PTransf16>()(p) == hash_fast(p.v));
+        CHECK(std::hash<PPerm16>()(p) == std::hash<epu8>()(p.v));
+        CHECK(std::hash<Vect16>()(p) == std::hash<epu8>()(p.v));
+    }
+    BMat8 bm = BMat8::random();
+    CHECK(std::hash<BMat8>()(bm) == hash_fast(bm.to_int()));
+    Subset16 s({1, 3, 7});
+    CHECK(std::hash<Subset16>()(s) == hash_fast(uint64_t(s.bits())));
+    CHECK(StrongHash<BMat8>()(bm) == hash_strong(bm.to_int()));
+}
+
+TEST_CASE("Hash::no_collisions", "[Hash][001]") {
+    auto perms = all_perms(8);
+    std::unordered_set<uint64_t> fast, strong;
+    for (auto p : perms) {
+        fast.insert(FastHash<Perm16>()(p));
+        strong.insert(StrongHash<Perm16>()(p));
+    }
+    CHECK(fast.size() == perms.size());
+    CHECK(strong.size() == perms.size());
+    std::unordered_set<uint64_t> fast128, strong128;
+    for (auto p : perms) {
+        fast128.insert(FastHash<PPerm16>()(p));
+        strong128.insert(StrongHash<PPerm16>()(p));
+    }
+    CHECK(fast128.size() == perms.size());
+    CHECK(strong128.size() == perms.size());
+}
+
+TEST_CASE("Hash::strong_avalanche", "[Hash][002]") {
+    // Flipping one input bit flips about half of the output bits
+    size_t total = 0, nb = 0;
+    for (uint64_t x = 0; x < 1000; x++) {
+        for (size_t b = 0; b < 64; b++, nb++)
+            total += __builtin_popcountll(hash_strong(x) ^
+                                          hash_strong(x ^ (uint64_t(1) << b)));
+    }
+    CHECK(total > 31 * nb);
+    CHECK(total < 33 * nb);
+}
+
+TEST_CASE("Hash::hash_many", "[Hash][003]") {
+    for (size_t n : {0, 1, 3, 4, 5, 100}) {
+        std::vector<Perm16> perms = Perm16::random_many(n);
+        check_hash_many<Perm16, FastHash<Perm16>>(perms);
+        check_hash_many<Perm16, StrongHash<Perm16>>(perms);
+        check_hash_many<PTransf16, FastHash<PTransf16>>(
+            std::vector<PTransf16>(perms.begin(), perms.end()));
+        check_hash_many<BMat8, StrongHash<BMat8>>(BMat8::random_many(n));
+    }
+    std::vector<Transf16> transf = Transf16::random_many(10);
+    std::vector<uint64_t> out(10);
+    hash_many(transf.data(), transf.size(), out.data());
+    for (size_t i = 0; i < 10; i++)
+        CHECK(out[i] == std::hash<Transf16>()(transf[i]));
+}
+
+}  // namespace HPCombi
@@ -0,0 +1,108 @@
+//****************************************************************************//
+//     Copyright (C) 2016-2024 Florent Hivert <Florent.Hivert@lisn.fr>,       //
+//                                                                            //
+//  This file is part of HP-Combi <https://github.com/libsemigroups/HPCombi>  //
+//                                                                            //
+//  HP-Combi is free software: you can redistribute it and/or modify it       //
+//  under the terms of the GNU General Public License as published by the     //
+//  Free Software Foundation, either version 3 of the License, or             //
+//  (at your option) any later version.                                       //
+//                                                                            //
+//  HP-Combi is distributed in the hope that it will be useful, but WITHOUT   //
+//  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or     //
+//  FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License      //
+//  for  more details.                                                        //
+//                                                                            //
+//  You should have received a copy of the GNU General Public License along   //
+//  with HP-Combi. If not, see <https://www.gnu.org/licenses/>.               //
+//****************************************************************************//
+
+#include <algorithm>  // for sort, lower_bound, upper_bound, equal
+#include <cstddef>    // for size_t
+#include <cstdint>    // for uint8_t
+#include <vector>     // for vector
+
+#include "test_main.hpp"                 // for Equals
+#include <catch2/catch_test_macros.hpp>  // for operator""_catch_sr, operator==
+
+#include "hpcombi/lex_index.hpp"  // for LexIndex
+#include "hpcombi/random.hpp"     // for random_stream
+
+namespace HPCombi {
+namespace {
+
+bool lex_less(epu8 a, epu8 b) { return less(a, b); }
+
+// Keys over a small alphabet, so that there are many duplicates and many
+// keys sharing long prefixes
+std::vector<epu8> sorted_keys(size_t n, uint8_t alphabet) {
+    std::vector<epu8> res;
+    for (size_t i = 0; i < n; i++) {
+        epu8 v;
+        for (size_t j = 0; j < 16; j++)
+            v[j] = random_stream().below(alphabet);
+        res.push_back(v);
+    }
+    std::sort(res.begin(), res.end(), lex_less);
+    return res;
+}
+
+}  // namespace
+
+struct LexIndexFixture {
+    LexIndexFixture() {
+        for (size_t n : {0, 1, 3, 4, 5, 17, 20, 21, 100, 1000})
+            for (uint8_t alphabet : {2, 3, 255})
+                samples.push_back(sorted_keys(n, alphabet));
+        samples.push_back({Epu8(0), Epu8(0xFF), Epu8(0xFF)});
+    }
+    std::vector<std::vector<epu8>> samples;
+};
+
+TEST_CASE_METHOD(LexIndexFixture, "LexIndex::bounds", "[LexIndex][000]") {
+    for (auto const &keys : samples) {
+        LexIndex index(keys);
+        CHECK(index.size() == keys.size());
+        CHECK(std::equal(index.keys().begin(), index.keys().end(),
+                         keys.begin(), keys.end(),
+                         [](epu8 a, epu8 b) { return equal(a, b); }));
+        std::vector<epu8> queries = sorted_keys(200, 3);
+        queries.insert(queries.end(), keys.begin(), keys.end());
+        queries.push_back(Epu8(0));
+        queries.push_back(Epu8(0xFF));
+        for (epu8 x : queries) {
+            size_t lo = std::lower_bound(keys.begin(), keys.end(), x,
+                                         lex_less) -
+                        keys.begin();
+            size_t hi = std::upper_bound(keys.begin(), keys.end(), x,
+                                         lex_less) -
+                        keys.begin();
+            CHECK(index.lower_bound(x) == lo);
+            CHECK(index.upper_bound(x) == hi);
+            CHECK(index.contains(x) == (lo < hi));
+        }
+    }
+}
+
+TEST_CASE_METHOD(LexIndexFixture, "LexIndex::prefix_range",
+                 "[LexIndex][001]") {
+    for (auto const &keys : samples) {
+        LexIndex index(keys);
+        for (epu8 prefix : sorted_keys(20, 2)) {
+            for (size_t k = 0; k <= 16; k++) {
+                auto range = index.prefix_range(prefix, k);
+                size_t count = 0;
+                for (size_t r = 0; r < keys.size(); r++) {
+                    bool match = first_diff(keys[r], prefix, k) == 16;
+                    count += match;
+                    if (match)
+                        CHECK((range.first <= r && r < range.second));
+                }
+                CHECK(range.second - range.first == count);
+                CHECK(index.prefix_count(prefix, k) == count);
+            }
+        }
+    }
+}
+
+}  // namespace HPCombi
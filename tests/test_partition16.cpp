@@ -0,0 +1,197 @@
+//****************************************************************************//
+//    Copyright (C) 2018-2024 Finn Smith <fls3@st-andrews.ac.uk>              //
+//    Copyright (C) 2018-2024 James Mitchell <jdm3@st-andrews.ac.uk>          //
+//    Copyright (C) 2018-2024 Florent Hivert <Florent.Hivert@lisn.fr>,        //
+//                                                                            //
+//  This file is part of HP-Combi <https://github.com/libsemigroups/HPCombi>  //
+//                                                                            //
+//  HP-Combi is free software: you can redistribute it and/or modify it       //
+//  under the terms of the GNU General Public License as published by the     //
+//  Free Software Foundation, either version 3 of the License, or             //
+//  (at your option) any later version.                                       //
+//                                                                            //
+//  HP-Combi is distributed in the hope that it will be useful, but WITHOUT   //
+//  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or     //
+//  FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License      //
+//  for  more details.                                                        //
+//                                                                            //
+//  You should have received a copy of the GNU General Public License along   //
+//  with HP-Combi. If not, see <https://www.gnu.org/licenses/>.               //
+//****************************************************************************//
+
+#include <algorithm>      // for is_sorted, reverse
+#include <cstddef>        // for size_t
+#include <unordered_set>  // for unordered_set
+#include <vector>         // for vector
+
+#include "test_main.hpp"                 // for TEST_AGREES
+#include <catch2/catch_test_macros.hpp>  // for operator""_catch_sr, operator==
+
+#include "hpcombi/partition16.hpp"  // for Partition16, Composition16
+#include "hpcombi/perm16.hpp"       // for Perm16
+#include "hpcombi/subset16.hpp"     // for Subset16
+
+namespace HPCombi {
+
+namespace {
+
+// The partitions of n with parts at most m in reverse lexicographic order
+void partitions_ref(size_t n, size_t m, std::vector<uint8_t> &prefix,
+                    std::vector<Partition16> &res) {
+    if (n == 0) {
+        Partition16 p{};
+        for (size_t i = 0; i < prefix.size(); i++)
+            p[i] = prefix[i];
+        res.push_back(p);
+        return;
+    }
+    for (size_t a = std::min(n, m); a > 0; a--) {
+        prefix.push_back(a);
+        partitions_ref(n - a, a, prefix, res);
+        prefix.pop_back();
+    }
+}
+
+std::vector<Partition16> partitions_ref(size_t n) {
+    std::vector<uint8_t> prefix;
+    std::vector<Partition16> res;
+    partitions_ref(n, n, prefix, res);
+    return res;
+}
+
+}  // namespace
+
+TEST_CASE("Partition16::all", "[Partition16][000]") {
+    std::vector<size_t> const counts{1,  1,  2,  3,   5,   7,   11,  15, 22,
+                                     30, 42, 56, 77, 101, 135, 176, 231};
+    for (size_t n = 0; n <= 16; n++) {
+        auto all = Partition16::all(n);
+        CHECK(Partition16::count(n) == counts[n]);
+        CHECK(all == partitions_ref(n));
+        CHECK(all.front() == Partition16::first(n));
+        CHECK(all.back() == Partition16::last(n));
+        for (size_t r = 0; r < all.size(); r++) {
+            CHECK(all[r].validate());
+            CHECK(all[r].sum() == n);
+            CHECK(all[r].rank() == r);
+            CHECK(Partition16::unrank(n, r) == all[r]);
+        }
+    }
+}
+
+TEST_CASE("Partition16::next_lex", "[Partition16][001]") {
+    for (size_t n = 0; n <= 16; n++) {
+        auto all = Partition16::all(n);
+        std::reverse(all.begin(), all.end());
+        CHECK(std::is_sorted(all.begin(), all.end()));
+        Partition16 p = all.front();
+        for (size_t r = 1; r < all.size(); r++) {
+            CHECK(p.next_lex());
+            CHECK(p == all[r]);
+        }
+        CHECK(!p.next_lex());
+        CHECK(p == all.front());
+        p = Partition16::last(n);
+        CHECK(!p.next_revlex());
+        CHECK(p == Partition16::first(n));
+    }
+}
+
+TEST_CASE("Partition16::conjugate", "[Partition16][002]") {
+    CHECK(Partition16({4, 2, 1}).conjugate() == Partition16({3, 2, 1, 1}));
+    CHECK(Partition16({16}).conjugate() == Partition16::last(16));
+    CHECK(Partition16::last(16).conjugate() == Partition16({16}));
+    for (size_t n = 0; n <= 16; n++) {
+        for (auto p : Partition16::all(n)) {
+            Partition16 c = p.conjugate();
+            CHECK(c.validate());
+            CHECK(c.sum() == n);
+            CHECK(c.conjugate() == p);
+            CHECK(c[0] == p.length());
+        }
+    }
+}
+
+TEST_CASE("Partition16::dominates", "[Partition16][003]") {
+    CHECK(Partition16({3, 1}).dominates(Partition16({2, 2})));
+    CHECK(!Partition16({2, 2}).dominates(Partition16({3, 1})));
+    CHECK(!Partition16({3, 1, 1, 1}).dominates(Partition16({2, 2, 2})));
+    CHECK(!Partition16({2, 2, 2}).dominates(Partition16({3, 1, 1, 1})));
+    for (size_t n : {6, 10}) {
+        auto all = Partition16::all(n);
+        for (auto p : all) {
+            for (auto q : all) {
+                bool expected = true;
+                size_t sp = 0, sq = 0;
+                for (size_t i = 0; i < 16; i++) {
+                    sp += p[i];
+                    sq += q[i];
+                    expected &= sp >= sq;
+                }
+                CHECK(p.dominates(q) == expected);
+                // Dominance reverses under conjugation and refines lex order
+                CHECK(p.dominates(q) == q.conjugate().dominates(p.conjugate()));
+                if (p.dominates(q))
+                    CHECK(!(p < q));
+            }
+        }
+    }
+}
+
+TEST_CASE("Partition16::cycle_type", "[Partition16][004]") {
+    Perm16 x{1, 2, 3, 6, 0, 5, 4, 7, 8, 9, 10, 11, 12, 15, 14, 13};
+    CHECK(cycle_type(x) == Partition16({6, 2, 1, 1, 1, 1, 1, 1, 1, 1}));
+    CHECK(cycle_type(Perm16::one()) == Partition16::last(16));
+    CHECK(cycle_type(Perm16(Epu8.left_cycle())) == Partition16({16}));
+}
+
+TEST_CASE("Composition16::all", "[Composition16][000]") {
+    for (size_t n = 0; n <= 12; n++) {
+        auto all = Composition16::all(n);
+        CHECK(all.size() == Composition16::count(n));
+        CHECK(std::is_sorted(all.begin(), all.end()));
+        std::unordered_set<Composition16> seen(all.begin(), all.end());
+        CHECK(seen.size() == all.size());
+        std::unordered_set<Partition16> parts;
+        for (size_t r = 0; r < all.size(); r++) {
+            Composition16 c = all[r];
+            CHECK(c.validate());
+            CHECK(c.sum() == n);
+            CHECK(c.rank() == r);
+            CHECK(Composition16::from_descents(n, c.descents()) == c);
+            CHECK(c.descents().size() + 1 == std::max<size_t>(c.length(), 1));
+            parts.insert(c.to_partition());
+        }
+        CHECK(parts.size() == Partition16::count(n));
+        if (n > 0) {
+            CHECK(all.front() == Composition16(Partition16::last(n)));
+            CHECK(all.back() == Composition16(Partition16::first(n)));
+        }
+    }
+    CHECK(Composition16({2, 1, 3}).descents() == Subset16({2, 3}));
+    CHECK(Composition16::from_descents(16, Subset16({1, 15})) ==
+          Composition16({1, 14, 1}));
+    CHECK(Composition16::unrank(16, 0) == Partition16::last(16));
+}
+
+TEST_CASE("Composition16::next_lex", "[Composition16][001]") {
+    for (size_t n = 0; n <= 10; n++) {
+        auto all = Composition16::all(n);
+        Composition16 c = all.front();
+        for (size_t r = 1; r < all.size(); r++) {
+            CHECK(c.next_lex());
+            CHECK(c == all[r]);
+        }
+        CHECK(!c.next_lex());
+        CHECK(c == all.front());
+        c = all.back();
+        for (size_t r = all.size() - 1; r > 0; r--) {
+            CHECK(c.next_revlex());
+            CHECK(c == all[r - 1]);
+        }
+        CHECK(!c.next_revlex());
+        CHECK(c == all.back());
+    }
+}
+
+}  // namespace HPCombi
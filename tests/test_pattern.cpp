@@ -0,0 +1,134 @@
+//****************************************************************************//
+//     Copyright (C) 2016-2024 Florent Hivert <Florent.Hivert@lisn.fr>,       //
+//                                                                            //
+//  This file is part of HP-Combi <https://github.com/libsemigroups/HPCombi>  //
+//                                                                            //
+//  HP-Combi is free software: you can redistribute it and/or modify it       //
+//  under the terms of the GNU General Public License as published by the     //
+//  Free Software Foundation, either version 3 of the License, or             //
+//  (at your option) any later version.                                       //
+//                                                                            //
+//  HP-Combi is distributed in the hope that it will be useful, but WITHOUT   //
+//  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or     //
+//  FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License      //
+//  for  more details.                                                        //
+//                                                                            //
+//  You should have received a copy of the GNU General Public License along   //
+//  with HP-Combi. If not, see <https://www.gnu.org/licenses/>.               //
+//****************************************************************************//
+
+#include <algorithm>  // for next_permutation
+#include <cstddef>    // for size_t
+#include <cstdint>    // for uint8_t
+#include <vector>     // for vector
+
+#include "test_main.hpp"                 // for TEST_AGREES
+#include <catch2/catch_test_macros.hpp>  // for operator""_catch_sr, operator==
+
+#include "hpcombi/pattern.hpp"  // for PatternMatcher
+#include "hpcombi/perm16.hpp"   // for Perm16
+
+namespace HPCombi {
+namespace {
+
+std::vector<Perm16> all_perms(size_t n) {
+    std::vector<Perm16> res;
+    Perm16 p = Perm16::one();
+    do {
+        res.push_back(p);
+    } while (std::next_permutation(p.begin(), p.begin() + n));
+    return res;
+}
+
+size_t count_avoiders(PatternMatcher const &m, std::vector<Perm16> perms) {
+    size_t res = 0;
+    for (auto p : perms)
+        if (m.avoids(p))
+            res++;
+    return res;
+}
+
+struct PatternFixture {
+    const std::vector<Perm16> S7, RandPerms;
+    const PatternMatcher m231, m1234, m1342, mixed;
+    PatternFixture()
+        : S7(all_perms(7)), RandPerms(make_rand_perms()), m231({{1, 2, 0}}, 7),
+          m1234({{0, 1, 2, 3}}, 7), m1342({{0, 2, 3, 1}}, 7),
+          mixed({{3, 2, 1, 0, 4}, {1, 0, 3, 2}, {4, 0, 2, 3, 1, 5},
+                 {2, 0, 1, 3, 4}, {3, 2, 1, 0, 4}}) {}
+
+    static std::vector<Perm16> make_rand_perms() {
+        std::vector<Perm16> res;
+        for (size_t i = 0; i < 200; i++)
+            res.push_back(Perm16::random());
+        res.push_back(Perm16::one());
+        res.push_back(Epu8.rev());
+        return res;
+    }
+};
+}  // namespace
+
+TEST_CASE_METHOD(PatternFixture, "PatternMatcher::PatternMatcher",
+                 "[PatternMatcher][000]") {
+    CHECK(m231.size() == 7);
+    CHECK(m231.nb_patterns() == 1);
+    CHECK(mixed.size() == 16);
+    CHECK(mixed.nb_patterns() == 4);
+    CHECK(PatternMatcher({{2, 1, 0}}, 4).contains(Perm16({0, 3, 2, 1})));
+    CHECK(!PatternMatcher({{2, 1, 0}}, 4).contains(Perm16({0, 3, 1, 2})));
+    CHECK(PatternMatcher({{0}}, 16).contains(Perm16::one()));
+    CHECK(PatternMatcher({{0, 1, 2, 3, 4, 5, 6, 7}}).contains(Perm16::one()));
+    CHECK(
+        !PatternMatcher({{0, 1, 2, 3, 4, 5, 6, 7}}).contains(Epu8.rev()));
+}
+
+TEST_CASE_METHOD(PatternFixture, "PatternMatcher::contains_ref",
+                 "[PatternMatcher][001]") {
+    CHECK(m231.contains_ref(Perm16({1, 2, 0})));
+    CHECK(!m231.contains_ref(Perm16::one()));
+    size_t nb = 0;
+    for (auto p : S7)
+        if (!m231.contains_ref(p))
+            nb++;
+    CHECK(nb == 429);
+}
+
+TEST_CASE_METHOD(PatternFixture, "PatternMatcher::contains",
+                 "[PatternMatcher][002]") {
+    // Catalan number and Wilf classes of patterns of size 4
+    CHECK(count_avoiders(m231, S7) == 429);
+    CHECK(count_avoiders(m1234, S7) == 2761);
+    CHECK(count_avoiders(m1342, S7) == 2740);
+    CHECK(count_avoiders(PatternMatcher({{0, 2, 1}, {0, 1, 2}}, 7), S7) == 64);
+    for (auto p : S7) {
+        CHECK(m1234.contains(p) == m1234.contains_ref(p));
+        CHECK(m1342.contains(p) == m1342.contains_ref(p));
+    }
+}
+
+TEST_CASE_METHOD(PatternFixture, "PatternMatcher::contains on Perm16",
+                 "[PatternMatcher][003]") {
+    for (auto p : RandPerms)
+        CHECK(mixed.contains(p) == mixed.contains_ref(p));
+}
+
+TEST_CASE_METHOD(PatternFixture, "PatternMatcher::contains_many",
+                 "[PatternMatcher][004]") {
+    std::vector<bool> res = m1342.contains_many(S7);
+    REQUIRE(res.size() == S7.size());
+    for (size_t i = 0; i < S7.size(); i++)
+        CHECK(res[i] == m1342.contains(S7[i]));
+    res = mixed.contains_many(RandPerms);
+    for (size_t i = 0; i < RandPerms.size(); i++)
+        CHECK(res[i] == mixed.contains(RandPerms[i]));
+    CHECK(m1342.contains_many({}).empty());
+}
+
+TEST_CASE_METHOD(PatternFixture, "PatternMatcher::avoiders",
+                 "[PatternMatcher][005]") {
+    CHECK(m231.avoiders(S7).size() == 429);
+    for (auto p : m1234.avoiders(S7))
+        CHECK(m1234.avoids(p));
+}
+
+}  // namespace HPCombi
@@ -341,6 +341,49 @@ TEST_CASE_METHOD(Perm16Fixture, "Transf16::hash", "[Transf16][014]") {
     CHECK(std::hash<Transf16>()(RandT) != 0);
 }
 
+TEST_CASE("Transf16::is_idempotent", "[Transf16][015]") {
+    // All the transformations of {0, 1, 2, 3}
+    std::vector<Transf16> sample;
+    for (size_t i = 0; i < 256; i++) {
+        Transf16 t = Transf16::one();
+        for (size_t j = 0; j < 4; j++)
+            t[j] = (i >> (2 * j)) & 3;
+        sample.push_back(t);
+    }
+    size_t nr_idempotents = 0;
+    for (auto t : sample) {
+        CHECK(t.is_idempotent() == (t * t == t));
+        CHECK(t.is_idempotent_ref() == t.is_idempotent());
+        nr_idempotents += t.is_idempotent();
+    }
+    CHECK(nr_idempotents == 41);
+    for (auto t : Transf16::random_many(100, 16)) {
+        CHECK(t.is_idempotent() == (t * t == t));
+        CHECK(t.is_idempotent_ref() == t.is_idempotent());
+    }
+    std::vector<uint64_t> out(4);
+    for (size_t n : {size_t(0), size_t(1), size_t(64), size_t(131),
+                     sample.size()}) {
+        out.assign(4, ~uint64_t(0));
+        Transf16::is_idempotent_many(sample.data(), n, out.data());
+        for (size_t j = 0; j < (n + 63) / 64 * 64; j++) {
+            bool expected = j < n && sample[j].is_idempotent();
+            CHECK(((out[j / 64] >> (j % 64)) & 1) == expected);
+        }
+    }
+}
+
+TEST_CASE("PTransf16::is_idempotent", "[PTransf16][012]") {
+    // All the partial transformations of {0, 1, 2}
+    for (size_t i = 0; i < 64; i++) {
+        PTransf16 t = PTransf16::one();
+        for (size_t j = 0; j < 3; j++)
+            t[j] = ((i >> (2 * j)) & 3) == 3 ? 0xFF : (i >> (2 * j)) & 3;
+        CHECK(t.is_idempotent() == (t * t == t));
+        CHECK(t.is_idempotent_ref() == t.is_idempotent());
+    }
+}
+
 TEST_CASE_METHOD(Perm16Fixture, "Perm16::operator uint64_t", "[Perm16][015]") {
     CHECK(static_cast<uint64_t>(Perm16::one()) == 0xf7e6d5c4b3a29180);
     CHECK(static_cast<uint64_t>(PPa) == 0xf7e6d5c0b4a39281);
@@ -535,4 +578,273 @@ TEST_CASE_METHOD(Perm16Fixture, "Perm16::left_weak_leq", "[Perm16][044]") {
         }
     }
 }
+
+TEST_CASE_METHOD(Perm16Fixture, "Perm16::right_weak_leq_ref", "[Perm16][045]") {
+    CHECK(Perm16::one().right_weak_leq_ref(PPa));
+    CHECK(Perm16::one().right_weak_leq_ref(PPb));
+    CHECK(PPa.right_weak_leq_ref(PPa));
+    CHECK(Perm16({1, 0, 2, 3}).right_weak_leq_ref(Perm16({1, 2, 0, 3})));
+    CHECK(!Perm16({1, 0, 2, 3}).right_weak_leq_ref(Perm16({2, 0, 1, 3})));
+}
+
+TEST_AGREES2(Perm16Fixture, right_weak_leq_ref, right_weak_leq, PlistSmall,
+             "[Perm16][046]");
+
+TEST_CASE_METHOD(Perm16Fixture, "Perm16::left_weak_join", "[Perm16][047]") {
+    CHECK(Perm16({1, 0, 2, 3}).left_weak_join(Perm16({0, 2, 1, 3})) ==
+          Perm16({2, 1, 0, 3}));
+    CHECK(Perm16({1, 0, 2, 3}).left_weak_meet(Perm16({0, 2, 1, 3})) ==
+          Perm16::one());
+    std::vector<Perm16> S4;
+    for (auto u : PlistSmall)
+        if (u[4] == 4 && u[5] == 5)
+            S4.push_back(u);
+    REQUIRE(S4.size() == 24);
+    for (auto u : S4) {
+        for (auto v : S4) {
+            Perm16 join = u.left_weak_join(v), meet = u.left_weak_meet(v);
+            CHECK(u.left_weak_leq_ref(join));
+            CHECK(v.left_weak_leq_ref(join));
+            CHECK(meet.left_weak_leq_ref(u));
+            CHECK(meet.left_weak_leq_ref(v));
+            for (auto w : S4) {
+                if (u.left_weak_leq_ref(w) && v.left_weak_leq_ref(w))
+                    CHECK(join.left_weak_leq_ref(w));
+                if (w.left_weak_leq_ref(u) && w.left_weak_leq_ref(v))
+                    CHECK(w.left_weak_leq_ref(meet));
+            }
+        }
+    }
+}
+
+TEST_CASE_METHOD(Perm16Fixture, "Perm16::right_weak_join", "[Perm16][048]") {
+    for (auto u : PlistSmall) {
+        for (auto v : {PPa, PPb, Perm16::one()}) {
+            Perm16 join = u.right_weak_join(v), meet = u.right_weak_meet(v);
+            CHECK(u.right_weak_leq_ref(join));
+            CHECK(v.right_weak_leq_ref(join));
+            CHECK(meet.right_weak_leq_ref(u));
+            CHECK(meet.right_weak_leq_ref(v));
+        }
+    }
+}
+
+TEST_CASE_METHOD(Perm16Fixture, "Perm16::bruhat_leq_ref", "[Perm16][049]") {
+    CHECK(Perm16::one().bruhat_leq_ref(PPa));
+    CHECK(Perm16::one().bruhat_leq_ref(PPb));
+    CHECK(!PPa.bruhat_leq_ref(Perm16::one()));
+    CHECK(Perm16({1, 0, 2, 3}).bruhat_leq_ref(Perm16({2, 1, 0, 3})));
+    CHECK(!Perm16({1, 0, 2, 3}).bruhat_leq_ref(Perm16({0, 2, 1, 3})));
+    for (auto u : PlistSmall) {
+        CHECK(u.bruhat_leq_ref(Perm16({5, 4, 3, 2, 1, 0})));
+        CHECK(u.bruhat_leq_ref(Epu8.rev()));
+    }
+}
+
+TEST_CASE_METHOD(Perm16Fixture, "Perm16::bruhat_leq", "[Perm16][050]") {
+    for (auto u : PlistSmall) {
+        for (auto v : PlistSmall) {
+            CHECK(u.bruhat_leq(v) == u.bruhat_leq_ref(v));
+            if (u.left_weak_leq(v) || u.right_weak_leq(v))
+                CHECK(u.bruhat_leq(v));
+        }
+    }
+    for (auto u : Plist)
+        CHECK(u.bruhat_leq(RandPerm) == u.bruhat_leq_ref(RandPerm));
+}
+
+TEST_CASE_METHOD(Perm16Fixture, "Perm16::descents_bitset_ref",
+                 "[Perm16][051]") {
+    CHECK(Perm16::one().descents_bitset_ref() == 0);
+    CHECK(Perm16({0, 3, 2, 4, 1}).descents_bitset_ref() == 0b1010);
+    CHECK(Perm16(Epu8.rev()).descents_bitset_ref() == 0x7FFF);
+}
+
+TEST_AGREES(Perm16Fixture, descents_bitset_ref, descents_bitset, Plist,
+            "[Perm16][052]");
+
+TEST_CASE_METHOD(Perm16Fixture, "Perm16::reduced_word_ref", "[Perm16][053]") {
+    CHECK(Perm16::one().reduced_word_ref().empty());
+    CHECK(Perm16({0, 2, 1}).reduced_word_ref() == std::vector<uint8_t>{1});
+    for (auto p : Plist) {
+        auto word = p.reduced_word_ref();
+        CHECK(word.size() == p.length());
+        Perm16 prod = Perm16::one();
+        for (auto i : word)
+            prod = prod * Perm16::elementary_transposition(i);
+        CHECK(prod == p);
+    }
+}
+
+TEST_CASE_METHOD(Perm16Fixture, "Perm16::reduced_word", "[Perm16][054]") {
+    for (auto p : Plist) {
+        auto word = p.reduced_word();
+        CHECK(word.size() == p.length());
+        Perm16 prod = Perm16::one();
+        for (auto i : word)
+            prod = prod * Perm16::elementary_transposition(i);
+        CHECK(prod == p);
+    }
+    CHECK(RandPerm.reduced_word().size() == RandPerm.length());
+}
+
+TEST_CASE_METHOD(Perm16Fixture, "PPerm16::natural_leq", "[PPerm16][055]") {
+    CHECK(PPerm16({FF, 2, FF, 3}).natural_leq(PPerm16({0, 2, 1, 3})));
+    CHECK(!PPerm16({FF, 2, FF, 3}).natural_leq(PPerm16({0, 1, 2, 3})));
+    CHECK(PPerm16(Epu8(FF)).natural_leq(RandPerm));
+    for (size_t i = 0; i < PPlist.size(); i += 25) {
+        auto u = PPlist[i];
+        CHECK(u.natural_leq(u));
+        for (size_t j = 0; j < PPlist.size(); j += 25) {
+            auto v = PPlist[j];
+            CHECK(u.natural_leq(v) == u.natural_leq_ref(v));
+        }
+    }
+}
+
+TEST_CASE_METHOD(Perm16Fixture, "PPerm16::restricted", "[PPerm16][056]") {
+    CHECK(PPerm16({0, 2, 1, 3}).restricted(0b1010) ==
+          PPerm16({FF, 2, FF, 3, FF, FF, FF, FF, FF, FF, FF, FF, FF, FF, FF,
+                   FF}));
+    CHECK(PPerm16({0, 2, 1, 3}).corestricted(0b1010) ==
+          PPerm16({FF, FF, 1, 3, FF, FF, FF, FF, FF, FF, FF, FF, FF, FF, FF,
+                   FF}));
+    for (auto pp : PPlist) {
+        for (uint32_t dom : {0x0000, 0xFFFF, 0x1234, 0xA5A5, 0x0F0F}) {
+            CHECK(pp.restricted(dom) == pp.restricted_ref(dom));
+            CHECK(pp.restricted(dom).natural_leq(pp));
+            CHECK(pp.restricted(dom).domain_bitset() ==
+                  (pp.domain_bitset() & dom));
+            CHECK(pp.corestricted(dom).image_bitset() ==
+                  (pp.image_bitset() & dom));
+            CHECK(pp.corestricted(dom).natural_leq(pp));
+        }
+    }
+    auto res = PPerm16::restricted_many(PPlist, 0x1234);
+    REQUIRE(res.size() == PPlist.size());
+    for (size_t i = 0; i < PPlist.size(); i++)
+        CHECK(res[i] == PPlist[i].restricted(0x1234));
+}
+
+TEST_CASE_METHOD(Perm16Fixture, "PPerm16::meet", "[PPerm16][057]") {
+    CHECK(PPerm16({0, 1, 2, 3}).meet(PPerm16({0, 2, 1, 3})) ==
+          PPerm16({0, FF, FF, 3}));
+    for (size_t i = 0; i < PPlist.size(); i += 25) {
+        auto u = PPlist[i];
+        for (size_t j = 0; j < PPlist.size(); j += 25) {
+            auto v = PPlist[j];
+            auto m = u.meet(v);
+            CHECK(m == u.meet_ref(v));
+            CHECK(m.natural_leq(u));
+            CHECK(m.natural_leq(v));
+        }
+    }
+    auto res = PPerm16(PPa).meet_many(PPlist);
+    auto leq = PPerm16(PPb).natural_leq_many(PPlist);
+    REQUIRE(res.size() == PPlist.size());
+    REQUIRE(leq.size() == PPlist.size());
+    for (size_t i = 0; i < PPlist.size(); i++) {
+        CHECK(res[i] == PPerm16(PPa).meet(PPlist[i]));
+        CHECK(leq[i] == PPerm16(PPb).natural_leq(PPlist[i]));
+    }
+}
+
+TEST_CASE_METHOD(Perm16Fixture, "PPerm16::join", "[PPerm16][058]") {
+    CHECK(PPerm16({0, FF, FF, 3}).join(PPerm16({FF, 2, FF, 3})) ==
+          PPerm16({0, 2, FF, 3}));
+    CHECK(!PPerm16({0, FF, FF, 3}).is_compatible(PPerm16({FF, 0, FF, 3})));
+    CHECK(!PPerm16({0, FF, FF, 3}).is_compatible(PPerm16({1, FF, FF, 3})));
+    for (size_t i = 0; i < PPlist.size(); i += 25) {
+        auto u = PPlist[i];
+        for (size_t j = 0; j < PPlist.size(); j += 25) {
+            auto v = PPlist[j];
+            CHECK(u.is_compatible(v) == u.is_compatible_ref(v));
+        }
+        for (uint32_t dom1 : {0x0000, 0x1234, 0xA5A5})
+            for (uint32_t dom2 : {0x0000, 0xFFFF, 0x0F0F, 0x5A5A}) {
+                PPerm16 f = u.restricted(dom1), g = u.restricted(dom2);
+                REQUIRE(f.is_compatible(g));
+                CHECK(f.join(g) == u.restricted(dom1 | dom2));
+            }
+    }
+}
+
+TEST_CASE_METHOD(Perm16Fixture, "PPerm16::mult_track", "[PPerm16][059]") {
+    PPerm16 prod = PPerm16::one(), inv = PPerm16::one();
+    uint32_t dom, img;
+    for (size_t i = 0; i < PPlist.size(); i += 7) {
+        PPerm16 p = PPlist[i];
+        PPerm16 res = prod.mult_track(p, p.inverse_ref(), inv, dom, img);
+        CHECK(res == prod * p);
+        CHECK(inv == res.inverse_ref());
+        CHECK(dom == res.domain_bitset());
+        CHECK(img == res.image_bitset());
+        // Restart when nothing is left
+        prod = (dom == 0) ? PPerm16::one() : res;
+        inv = (dom == 0) ? PPerm16::one() : inv;
+    }
+}
+TEST_AGREES(Perm16Fixture, inverse_ref, inverse_cycle, PPlist,
+            "[PPerm16][060]");
+TEST_AGREES(Perm16Fixture, inverse_ref, inverse, PPlist, "[PPerm16][061]");
+
+TEST_CASE_METHOD(Perm16Fixture, "PPerm16::inverse2", "[PPerm16][062]") {
+    for (size_t i = 0; i + 1 < PPlist.size(); i++) {
+        PPerm16 a = PPlist[i], b = PPlist[PPlist.size() - 1 - i];
+        PPerm16::inverse2(a, b);
+        CHECK(a == PPlist[i].inverse_ref());
+        CHECK(b == PPlist[PPlist.size() - 1 - i].inverse_ref());
+    }
+}
+
+TEST_CASE_METHOD(Perm16Fixture, "Perm16::conjugate_commutator",
+                 "[Perm16][063]") {
+    for (auto a : PlistSmall) {
+        for (auto b : {Perm16::one(), RandPerm, PlistSmall[100]}) {
+            CHECK(conjugate(a, b) == a.inverse_ref() * b * a);
+            CHECK(commutator(a, b) ==
+                  a.inverse_ref() * b.inverse_ref() * a * b);
+        }
+        CHECK(conjugate(a, a) == a);
+        CHECK(commutator(a, a) == Perm16::one());
+    }
+}
+
+TEST_CASE_METHOD(Perm16Fixture, "Perm16::conjugate_all", "[Perm16][064]") {
+    for (auto g : {Perm16::one(), RandPerm, PlistSmall[42]}) {
+        auto res = conjugate_all(PlistSmall, g);
+        REQUIRE(res.size() == PlistSmall.size());
+        for (size_t i = 0; i < res.size(); i++)
+            CHECK(res[i] == conjugate(g, PlistSmall[i]));
+    }
+}
+
+TEST_CASE("Perm16::right_coset_reps", "[Perm16][065]") {
+    auto s = [](uint8_t i) { return Perm16::elementary_transposition(i); };
+    std::vector<Perm16> S3{s(0), s(1)};
+    auto reps = right_coset_reps(S3, {s(0)});
+    CHECK(reps.size() == 3);
+    CHECK(reps[0] == Perm16::one());
+
+    std::vector<Perm16> S6{s(0), s(1), s(2), s(3), s(4)};
+    CHECK(right_coset_reps(S6, {}).size() == 720);
+    CHECK(right_coset_reps(S6, S6).size() == 1);
+    reps = right_coset_reps(S6, {s(0), s(1), s(3), s(4)});
+    CHECK(reps.size() == 20);
+    // Representatives are minimal in their coset and pairwise non equivalent
+    std::vector<Perm16> H{Perm16::one(), s(0), s(1), s(0) * s(1),
+                          s(1) * s(0), s(0) * s(1) * s(0)};
+    for (size_t i = 0; i < reps.size(); i++) {
+        for (auto h : H)
+            CHECK(!(h * reps[i] < reps[i]));
+        for (size_t j = 0; j < i; j++)
+            CHECK(reps[i] * reps[j].inverse_ref() != Perm16::one());
+    }
+}
+
+TEST_AGREES2(Perm16Fixture, left_weak_join_ref, left_weak_join, PlistSmall,
+             "[Perm16][066]");
+TEST_AGREES2(Perm16Fixture, left_weak_meet_ref, left_weak_meet, PlistSmall,
+             "[Perm16][067]");
+
 }  // namespace HPCombi
@@ -0,0 +1,115 @@
+//****************************************************************************//
+//     Copyright (C) 2016-2024 Florent Hivert <Florent.Hivert@lisn.fr>,       //
+//                                                                            //
+//  This file is part of HP-Combi <https://github.com/libsemigroups/HPCombi>  //
+//                                                                            //
+//  HP-Combi is free software: you can redistribute it and/or modify it       //
+//  under the terms of the GNU General Public License as published by the     //
+//  Free Software Foundation, either version 3 of the License, or             //
+//  (at your option) any later version.                                       //
+//                                                                            //
+//  HP-Combi is distributed in the hope that it will be useful, but WITHOUT   //
+//  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or     //
+//  FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License      //
+//  for  more details.                                                        //
+//                                                                            //
+//  You should have received a copy of the GNU General Public License along   //
+//  with HP-Combi. If not, see <https://www.gnu.org/licenses/>.               //
+//****************************************************************************//
+
+#include <cstddef>        // for size_t
+#include <map>            // for map
+#include <unordered_set>  // for unordered_set
+#include <vector>         // for vector
+
+#include "test_main.hpp"                 // for TEST_AGREES
+#include <catch2/catch_test_macros.hpp>  // for operator""_catch_sr, operator==
+
+#include "hpcombi/bmat8.hpp"                // for BMat8
+#include "hpcombi/perm16.hpp"               // for Perm16, Transf16
+#include "hpcombi/product_replacement.hpp"  // for ProductReplacement
+
+namespace HPCombi {
+
+TEST_CASE("ProductReplacement::Perm16", "[ProductReplacement][000]") {
+    // S_6 generated by a transposition and a long cycle
+    std::vector<Perm16> gens{Perm16({1, 0}),
+                             Perm16({1, 2, 3, 4, 5, 0})};
+    ProductReplacement<Perm16> sampler(gens, 42);
+    CHECK(sampler.pool_size() == 10);
+    std::map<Perm16, size_t> count;
+    for (auto p : sampler.sample(72000)) {
+        CHECK(p.validate());
+        for (size_t i = 6; i < 16; i++)
+            CHECK(p[i] == i);
+        count[p]++;
+    }
+    // 100 expected for each permutation
+    CHECK(count.size() == 720);
+    for (auto [p, c] : count) {
+        CHECK(c > 40);
+        CHECK(c < 180);
+    }
+}
+
+TEST_CASE("ProductReplacement::seed", "[ProductReplacement][001]") {
+    std::vector<Perm16> gens{Perm16({1, 0}), Perm16({1, 2, 3, 4, 0})};
+    ProductReplacement<Perm16> a(gens, 1), b(gens, 1), c(gens, 2);
+    auto sa = a.sample(100);
+    CHECK(sa == b.sample(100));
+    CHECK(sa != c.sample(100));
+    ProductReplacement<Perm16> d(gens, 1, 4, 0);
+    CHECK(d.pool_size() == 4);
+    ProductReplacement<Perm16> single(gens, 1, 1, 10);
+    CHECK(single.pool_size() == 2);
+    CHECK(single().validate());
+    ProductReplacement<Perm16> e(gens);
+    CHECK(e().validate());
+    ProductReplacement<Perm16> trivial({}, 3);
+    CHECK(trivial() == Perm16::one());
+}
+
+TEST_CASE("ProductReplacement::Transf16", "[ProductReplacement][002]") {
+    // The full transformation monoid T_4
+    std::vector<Transf16> gens{Transf16({1, 0}), Transf16({1, 2, 3, 0}),
+                               Transf16({0, 0})};
+    ProductReplacement<Transf16> sampler(gens, 7, 0, 10);
+    std::unordered_set<Transf16> seen;
+    for (auto t : sampler.sample(10000)) {
+        CHECK(t.validate());
+        for (size_t i = 0; i < 4; i++)
+            CHECK(t[i] < 4);
+        for (size_t i = 4; i < 16; i++)
+            CHECK(t[i] == i);
+        seen.insert(t);
+    }
+    CHECK(seen.size() > 1);
+    CHECK(seen.size() <= 256);
+}
+
+TEST_CASE("ProductReplacement::BMat8", "[ProductReplacement][003]") {
+    std::vector<BMat8> gens{BMat8({{1, 1}, {0, 1}}), BMat8({{0, 1}, {1, 0}})};
+    ProductReplacement<BMat8> sampler(gens, 5);
+    for (auto m : sampler.sample(1000)) {
+        // Supported on the top left 2x2 block
+        CHECK((m.to_int() & ~BMat8({{1, 1}, {1, 1}}).to_int()) == 0);
+        CHECK(m.row_space_size() >= 2);
+    }
+}
+
+TEST_CASE("ProductReplacement::Transf16 ranks", "[ProductReplacement][004]") {
+    // The full transformation monoid T_8
+    std::vector<Transf16> gens{Transf16({1, 0}),
+                               Transf16({1, 2, 3, 4, 5, 6, 7, 0}),
+                               Transf16({0, 0})};
+    ProductReplacement<Transf16> sampler(gens, 11);
+    std::map<size_t, size_t> ranks;
+    for (auto t : sampler.sample(10000))
+        ranks[t.rank() - 8]++;
+    // Not only the constant maps of the minimal ideal
+    CHECK(ranks[8] > 500);
+    for (size_t r = 2; r < 8; r++)
+        CHECK(ranks[r] > 100);
+}
+
+}  // namespace HPCombi
@@ -0,0 +1,150 @@
+//****************************************************************************//
+//     Copyright (C) 2016-2024 Florent Hivert <Florent.Hivert@lisn.fr>,       //
+//                                                                            //
+//  This file is part of HP-Combi <https://github.com/libsemigroups/HPCombi>  //
+//                                                                            //
+//  HP-Combi is free software: you can redistribute it and/or modify it       //
+//  under the terms of the GNU General Public License as published by the     //
+//  Free Software Foundation, either version 3 of the License, or             //
+//  (at your option) any later version.                                       //
+//                                                                            //
+//  HP-Combi is distributed in the hope that it will be useful, but WITHOUT   //
+//  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or     //
+//  FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License      //
+//  for  more details.                                                        //
+//                                                                            //
+//  You should have received a copy of the GNU General Public License along   //
+//  with HP-Combi. If not, see <https://www.gnu.org/licenses/>.               //
+//****************************************************************************//
+
+#include <cstddef>  // for size_t
+#include <cstdint>  // for uint64_t
+#include <map>      // for map
+#include <thread>   // for thread
+#include <vector>   // for vector
+
+#include "test_main.hpp"                 // for Equals
+#include <catch2/catch_test_macros.hpp>  // for operator""_catch_sr, operator==
+
+#include "hpcombi/bmat8.hpp"   // for BMat8
+#include "hpcombi/epu8.hpp"    // for random_epu8
+#include "hpcombi/perm16.hpp"  // for Perm16, Transf16
+#include "hpcombi/random.hpp"  // for RandomStream
+
+namespace HPCombi {
+
+TEST_CASE("RandomStream", "[RandomStream][000]") {
+    RandomStream a(42), b(42), c(43);
+    std::vector<uint64_t> va, vb, vc;
+    for (size_t i = 0; i < 100; i++) {
+        va.push_back(a());
+        vb.push_back(b());
+        vc.push_back(c());
+    }
+    CHECK(va == vb);
+    CHECK(va != vc);
+    a.seed(42);
+    CHECK(a() == va[0]);
+    a.discard(10);
+    CHECK(a() == va[11]);
+    RandomStream d(42);
+    epu8 w = d.next128();
+    CHECK(uint64_t(simde_mm_extract_epi64(w, 0)) == va[0]);
+    CHECK(uint64_t(simde_mm_extract_epi64(w, 1)) == va[1]);
+    CHECK(d() == va[2]);
+    for (size_t i = 0; i < 1000; i++) {
+        CHECK(a.below(7) < 7);
+        CHECK(a.below(1) == 0);
+    }
+}
+
+TEST_CASE("set_random_seed", "[RandomStream][001]") {
+    set_random_seed(123);
+    epu8 x = random_epu8(256);
+    Perm16 p = Perm16::random();
+    BMat8 m = BMat8::random();
+    set_random_seed(123);
+    CHECK(equal(x, random_epu8(256)));
+    CHECK(p == Perm16::random());
+    CHECK(m == BMat8::random());
+    // The values do not depend on the compiler
+    set_random_seed(123);
+    CHECK(equal(random_epu8(256), epu8{140, 151, 117, 69, 118, 243, 41, 170,
+                                       100, 140, 181, 237, 214, 74, 199, 114}));
+    CHECK(BMat8::random(8, 0.5) == BMat8(6038375561305712577));
+
+    // Each thread has its own stream
+    uint64_t here = random_stream()(), there = here;
+    std::thread t([&there] { there = random_stream()(); });
+    t.join();
+    CHECK(here != there);
+}
+
+TEST_CASE("random_epu8", "[RandomStream][002]") {
+    std::vector<size_t> count(256, 0);
+    for (size_t i = 0; i < 10000; i++) {
+        epu8 x = random_epu8(10);
+        for (size_t j = 0; j < 16; j++) {
+            CHECK(x[j] < 10);
+            count[x[j]]++;
+        }
+    }
+    // 16000 expected per value
+    for (size_t v = 0; v < 10; v++) {
+        CHECK(count[v] > 15000);
+        CHECK(count[v] < 17000);
+    }
+    for (size_t i = 0; i < 1000; i++)
+        random_epu8(256);
+    CHECK(equal(random_epu8(1), epu8{}));
+}
+
+TEST_CASE("Perm16::random", "[RandomStream][003]") {
+    for (size_t n = 0; n <= 16; n++) {
+        for (auto p : Perm16::random_many(100, n)) {
+            CHECK(p.validate());
+            for (size_t i = n; i < 16; i++)
+                CHECK(p[i] == i);
+        }
+    }
+    // All the 24 permutations of size 4 appear with the same frequency
+    std::map<Perm16, size_t> count;
+    for (auto p : Perm16::random_many(24000, 4))
+        count[p]++;
+    CHECK(count.size() == 24);
+    for (auto [p, c] : count) {
+        CHECK(c > 800);
+        CHECK(c < 1200);
+    }
+}
+
+TEST_CASE("Transf16::random", "[RandomStream][004]") {
+    for (size_t n = 0; n <= 16; n++) {
+        for (auto t : Transf16::random_many(100, n)) {
+            CHECK(t.validate());
+            for (size_t i = 0; i < 16; i++)
+                CHECK((i < n ? t[i] < n : t[i] == i));
+        }
+    }
+}
+
+TEST_CASE("BMat8::random with density", "[RandomStream][005]") {
+    for (size_t dim = 1; dim <= 8; dim++) {
+        CHECK(BMat8::random(dim, 0) == BMat8(0));
+        CHECK(BMat8::random(dim, 1) == BMat8::random(dim, 1).transpose());
+        CHECK(BMat8::random(dim, 1).row_space_size() == 2);
+    }
+    for (double density : {0.1, 0.5, 0.9}) {
+        size_t ones = 0;
+        for (auto m : BMat8::random_many(1000, 8, density))
+            ones += __builtin_popcountll(m.to_int());
+        CHECK(ones > (density - 0.02) * 64000);
+        CHECK(ones < (density + 0.02) * 64000);
+    }
+    for (auto m : BMat8::random_many(100, 5, 0.7))
+        for (size_t i = 0; i < 8; i++)
+            for (size_t j = 5; j < 8; j++)
+                CHECK((!m(i, j) && !m(j, i)));
+}
+
+}  // namespace HPCombi
@@ -0,0 +1,189 @@
+//****************************************************************************//
+//    Copyright (C) 2018-2024 Finn Smith <fls3@st-andrews.ac.uk>              //
+//    Copyright (C) 2018-2024 James Mitchell <jdm3@st-andrews.ac.uk>          //
+//    Copyright (C) 2018-2024 Florent Hivert <Florent.Hivert@lisn.fr>,        //
+//                                                                            //
+//  This file is part of HP-Combi <https://github.com/libsemigroups/HPCombi>  //
+//                                                                            //
+//  HP-Combi is free software: you can redistribute it and/or modify it       //
+//  under the terms of the GNU General Public License as published by the     //
+//  Free Software Foundation, either version 3 of the License, or             //
+//  (at your option) any later version.                                       //
+//                                                                            //
+//  HP-Combi is distributed in the hope that it will be useful, but WITHOUT   //
+//  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or     //
+//  FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License      //
+//  for  more details.                                                        //
+//                                                                            //
+//  You should have received a copy of the GNU General Public License along   //
+//  with HP-Combi. If not, see <https://www.gnu.org/licenses/>.               //
+//****************************************************************************//
+
+#include <algorithm>  // for sort, is_sorted
+#include <cstddef>    // for size_t
+#include <cstdint>    // for uint8_t
+#include <mutex>      // for mutex, lock_guard
+#include <vector>     // for vector
+
+#include "test_main.hpp"                 // for TEST_AGREES
+#include <catch2/catch_test_macros.hpp>  // for operator""_catch_sr, operator==
+
+#include "hpcombi/epu8.hpp"             // for epu8, random_epu8
+#include "hpcombi/perm16.hpp"           // for Transf16
+#include "hpcombi/set_partition16.hpp"  // for SetPartition16, kernel
+
+namespace HPCombi {
+
+namespace {
+
+// The blocks of p as bitsets, indexed by the elements
+std::vector<uint32_t> blocks_ref(SetPartition16 const &p) {
+    size_t const n = p.degree();
+    std::vector<uint32_t> res(n, 0);
+    for (size_t i = 0; i < n; i++)
+        for (size_t j = 0; j < n; j++)
+            if (p[i] == p[j])
+                res[i] |= 1 << j;
+    return res;
+}
+
+SetPartition16 join_ref(SetPartition16 const &p, SetPartition16 const &q) {
+    auto blk = blocks_ref(p), blq = blocks_ref(q);
+    std::vector<uint32_t> comp(blk.size());
+    for (size_t i = 0; i < blk.size(); i++) {
+        comp[i] = blk[i] | blq[i];
+        // Close under both relations
+        for (uint32_t prev = 0; prev != comp[i];) {
+            prev = comp[i];
+            for (size_t j = 0; j < blk.size(); j++)
+                if (prev & (1 << j))
+                    comp[i] |= blk[j] | blq[j];
+        }
+    }
+    epu8 labels = Epu8.id();
+    for (size_t i = 0; i < comp.size(); i++)
+        labels[i] = __builtin_ctz(comp[i]);
+    return SetPartition16::from_labels_ref(labels, p.degree());
+}
+
+}  // namespace
+
+TEST_CASE("SetPartition16::from_labels", "[SetPartition16][000]") {
+    CHECK(SetPartition16::from_labels(epu8{7, 3, 7, 9, 3, 3, 1}, 7) ==
+          SetPartition16({0, 1, 0, 2, 1, 1, 3}));
+    CHECK(SetPartition16::from_labels(Epu8.id()) ==
+          SetPartition16::discrete(16));
+    CHECK(SetPartition16::from_labels(Epu8(0xFF), 5) ==
+          SetPartition16::one_block(5));
+    for (size_t n = 0; n <= 16; n++) {
+        for (size_t bnd : {2, 5, 16, 256}) {
+            for (size_t i = 0; i < 100; i++) {
+                epu8 labels = random_epu8(bnd);
+                auto p = SetPartition16::from_labels(labels, n);
+                CHECK(p.validate());
+                CHECK(p.degree() == n);
+                CHECK(p == SetPartition16::from_labels_ref(labels, n));
+                // Relabelling the blocks does not change the partition
+                CHECK(SetPartition16::from_labels(p.v * Epu8(3) + Epu8(5),
+                                                  n) == p);
+            }
+        }
+    }
+}
+
+TEST_CASE("SetPartition16::kernel", "[SetPartition16][001]") {
+    for (auto t : Transf16::random_many(1000)) {
+        auto k = kernel(t);
+        CHECK(k.validate());
+        CHECK(k.degree() == 16);
+        CHECK(k.nb_blocks() == t.rank());
+        CHECK(k == kernel(Transf16(k.v)));
+        for (size_t i = 0; i < 16; i++)
+            for (size_t j = 0; j < 16; j++)
+                CHECK((k[i] == k[j]) == (t[i] == t[j]));
+    }
+}
+
+TEST_CASE("SetPartition16::all", "[SetPartition16][002]") {
+    std::vector<uint64_t> const bell{1,       1,        2,         5,
+                                     15,      52,       203,       877,
+                                     4140,    21147,    115975,    678570,
+                                     4213597, 27644437, 190899322, 1382958545,
+                                     10480142147};
+    for (size_t n = 0; n <= 16; n++)
+        CHECK(SetPartition16::count(n) == bell[n]);
+    for (size_t n = 0; n <= 8; n++) {
+        auto all = SetPartition16::all(n);
+        CHECK(all.size() == bell[n]);
+        CHECK(all.front() == SetPartition16::one_block(n));
+        CHECK(all.back() == SetPartition16::discrete(n));
+        CHECK(std::is_sorted(all.begin(), all.end()));
+        CHECK(std::adjacent_find(all.begin(), all.end()) == all.end());
+        for (auto p : all)
+            CHECK(p.validate());
+        SetPartition16 p = all.back();
+        CHECK(!p.next_lex());
+        CHECK(p == all.front());
+    }
+}
+
+TEST_CASE("SetPartition16::for_each_batch", "[SetPartition16][003]") {
+    for (size_t n : {0, 1, 4, 7, 9}) {
+        for (size_t nr_threads : {1, 3}) {
+            std::vector<SetPartition16> res;
+            std::mutex mtx;
+            SetPartition16::for_each_batch(
+                n,
+                [&res, &mtx](std::vector<SetPartition16> const &batch) {
+                    CHECK(batch.size() <= 100);
+                    std::lock_guard<std::mutex> lock(mtx);
+                    res.insert(res.end(), batch.begin(), batch.end());
+                },
+                nr_threads, 100);
+            std::sort(res.begin(), res.end());
+            CHECK(res == SetPartition16::all(n));
+        }
+    }
+}
+
+TEST_CASE("SetPartition16::join_meet", "[SetPartition16][004]") {
+    CHECK(SetPartition16({0, 0, 1, 1, 2}).join({0, 1, 1, 2, 2}) ==
+          SetPartition16::one_block(5));
+    CHECK(SetPartition16({0, 0, 1, 1, 2}).meet({0, 1, 1, 2, 2}) ==
+          SetPartition16::discrete(5));
+    for (size_t n : {0, 1, 5}) {
+        auto all = SetPartition16::all(n);
+        for (auto p : all) {
+            for (auto q : all) {
+                auto j = p.join(q), m = p.meet(q);
+                CHECK(j == join_ref(p, q));
+                CHECK(j == q.join(p));
+                CHECK(m == q.meet(p));
+                CHECK(m.validate());
+                CHECK(m.nb_blocks() >= std::max(p.nb_blocks(),
+                                                q.nb_blocks()));
+                bool expected = true;
+                for (size_t i = 0; i < n; i++)
+                    for (size_t k = 0; k < n; k++)
+                        if (p[i] == p[k] && q[i] != q[k])
+                            expected = false;
+                CHECK(p.refines(q) == expected);
+                CHECK(p.refines(q) == (m == p));
+                CHECK(p.refines(q) == (j == q));
+                CHECK(m.refines(p));
+                CHECK(p.refines(j));
+            }
+        }
+    }
+    // Long chains of blocks alternately from both partitions
+    CHECK(SetPartition16({0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7})
+              .join({0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8}) ==
+          SetPartition16::one_block(16));
+    for (size_t i = 0; i < 1000; i++) {
+        auto p = kernel(Transf16::random(16)),
+             q = kernel(Transf16::random(16));
+        CHECK(p.join(q) == join_ref(p, q));
+    }
+}
+
+}  // namespace HPCombi
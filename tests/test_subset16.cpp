@@ -0,0 +1,121 @@
+//****************************************************************************//
+//     Copyright (C) 2016-2024 Florent Hivert <Florent.Hivert@lisn.fr>,       //
+//                                                                            //
+//  This file is part of HP-Combi <https://github.com/libsemigroups/HPCombi>  //
+//                                                                            //
+//  HP-Combi is free software: you can redistribute it and/or modify it       //
+//  under the terms of the GNU General Public License as published by the     //
+//  Free Software Foundation, either version 3 of the License, or             //
+//  (at your option) any later version.                                       //
+//                                                                            //
+//  HP-Combi is distributed in the hope that it will be useful, but WITHOUT   //
+//  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or     //
+//  FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License      //
+//  for  more details.                                                        //
+//                                                                            //
+//  You should have received a copy of the GNU General Public License along   //
+//  with HP-Combi. If not, see <https://www.gnu.org/licenses/>.               //
+//****************************************************************************//
+
+#include <cstddef>  // for size_t
+#include <cstdint>  // for uint8_t, uint16_t
+#include <sstream>  // for ostringstream
+#include <vector>   // for vector
+
+#include "test_main.hpp"                 // for Equals
+#include <catch2/catch_test_macros.hpp>  // for operator""_catch_sr, operator==
+
+#include "hpcombi/subset16.hpp"  // for Subset16
+
+namespace HPCombi {
+
+TEST_CASE("Subset16::constructors", "[Subset16][000]") {
+    CHECK(Subset16().bits() == 0);
+    CHECK(Subset16({1, 4, 5}).bits() == 0b110010);
+    CHECK(Subset16::first(0) == Subset16());
+    CHECK(Subset16::first(3) == Subset16({0, 1, 2}));
+    CHECK(Subset16::first(16).bits() == 0xFFFF);
+    CHECK(Subset16::from_values(epu8{3, 3, 0, 200, 15, 3, 3, 3, 3, 3, 3, 3, 3,
+                                     3, 3, 3}) == Subset16({0, 3, 15}));
+    std::ostringstream out;
+    out << Subset16({1, 4, 5});
+    CHECK(out.str() == "{1, 4, 5}");
+}
+
+TEST_CASE("Subset16::masks", "[Subset16][001]") {
+    for (uint32_t b = 0; b < 0x10000; b += 3) {
+        auto s = Subset16(uint16_t(b));
+        CHECK(Subset16::from_mask(s.to_mask()) == s);
+        epu8 mask = s.to_mask();
+        for (size_t i = 0; i < 16; i++)
+            CHECK(mask[i] == (s.contains(i) ? 0xFF : 0));
+    }
+}
+
+TEST_CASE("Subset16::to_gather", "[Subset16][002]") {
+    CHECK_THAT(Subset16({1, 4, 5}).to_gather(),
+               Equals(Epu8({1, 4, 5}, 0xFF)));
+    CHECK_THAT(Subset16().to_gather(), Equals(Epu8(0xFF)));
+    CHECK_THAT(Subset16::first(16).to_gather(), Equals(Epu8.id()));
+    for (uint32_t b = 0; b < 0x10000; b++) {
+        auto s = Subset16(uint16_t(b));
+        epu8 ref = Epu8(0xFF);
+        size_t j = 0;
+        for (auto i : s)
+            ref[j++] = i;
+        CHECK(j == s.size());
+        CHECK(equal(s.to_gather(), ref));
+    }
+}
+
+TEST_CASE("Subset16::set_operations", "[Subset16][003]") {
+    Subset16 a({0, 2, 4, 6}), b({2, 3, 4});
+    CHECK((a | b) == Subset16({0, 2, 3, 4, 6}));
+    CHECK((a & b) == Subset16({2, 4}));
+    CHECK((a ^ b) == Subset16({0, 3, 6}));
+    CHECK((a - b) == Subset16({0, 6}));
+    CHECK(a.complement(8) == Subset16({1, 3, 5, 7}));
+    CHECK(a.complement().size() == 12);
+    CHECK((a & b).is_subset_of(a));
+    CHECK(!a.is_subset_of(b));
+    CHECK(Subset16().is_subset_of(b));
+    CHECK(Subset16().empty());
+    CHECK(!a.empty());
+    CHECK(a.contains(4));
+    CHECK(!a.contains(5));
+    CHECK(!a.contains(20));
+}
+
+TEST_CASE("Subset16::rank_unrank", "[Subset16][004]") {
+    for (size_t k = 0; k <= 16; k++) {
+        size_t r = 0;
+        Subset16::for_each_k_subset(16, k, [&r, k](Subset16 s) {
+            CHECK(s.size() == k);
+            CHECK(s.rank() == r);
+            CHECK(Subset16::unrank(k, r) == s);
+            r++;
+        });
+        CHECK(r == detail::binomials[16][k]);
+    }
+}
+
+TEST_CASE("Subset16::next_colex", "[Subset16][005]") {
+    for (size_t n : {0, 1, 5, 8, 16}) {
+        for (size_t k = 0; k <= n; k++) {
+            std::vector<Subset16> enumerated, iterated;
+            Subset16::for_each_k_subset(
+                n, k, [&enumerated](Subset16 s) { enumerated.push_back(s); });
+            CHECK(enumerated.size() == detail::binomials[n][k]);
+            Subset16 s = Subset16::first(k);
+            do {
+                iterated.push_back(s);
+            } while (s.next_colex(n));
+            CHECK(s == Subset16::first(k));
+            CHECK(enumerated == iterated);
+            for (size_t i = 1; i < iterated.size(); i++)
+                CHECK(iterated[i - 1] < iterated[i]);
+        }
+    }
+}
+
+}  // namespace HPCombi
@@ -0,0 +1,156 @@
+//****************************************************************************//
+//    Copyright (C) 2018-2024 Finn Smith <fls3@st-andrews.ac.uk>              //
+//    Copyright (C) 2018-2024 James Mitchell <jdm3@st-andrews.ac.uk>          //
+//    Copyright (C) 2018-2024 Florent Hivert <Florent.Hivert@lisn.fr>,        //
+//                                                                            //
+//  This file is part of HP-Combi <https://github.com/libsemigroups/HPCombi>  //
+//                                                                            //
+//  HP-Combi is free software: you can redistribute it and/or modify it       //
+//  under the terms of the GNU General Public License as published by the     //
+//  Free Software Foundation, either version 3 of the License, or             //
+//  (at your option) any later version.                                       //
+//                                                                            //
+//  HP-Combi is distributed in the hope that it will be useful, but WITHOUT   //
+//  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or     //
+//  FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License      //
+//  for  more details.                                                        //
+//                                                                            //
+//  You should have received a copy of the GNU General Public License along   //
+//  with HP-Combi. If not, see <https://www.gnu.org/licenses/>.               //
+//****************************************************************************//
+
+#include <algorithm>  // for upper_bound, max
+#include <cstddef>    // for size_t
+#include <cstdint>    // for uint8_t
+#include <vector>     // for vector
+
+#include "test_main.hpp"                 // for TEST_AGREES
+#include <catch2/catch_test_macros.hpp>  // for operator""_catch_sr, operator==
+
+#include "hpcombi/epu8.hpp"         // for epu8, random_epu8
+#include "hpcombi/partition16.hpp"  // for Partition16
+#include "hpcombi/perm16.hpp"       // for Perm16
+#include "hpcombi/tableau16.hpp"    // for Tableau16, rsk
+
+namespace HPCombi {
+
+namespace {
+
+// Reference RSK with rows stored in vectors
+std::pair<std::vector<std::vector<uint8_t>>, std::vector<std::vector<uint8_t>>>
+rsk_ref(epu8 w, size_t n) {
+    std::vector<std::vector<uint8_t>> p, q;
+    for (size_t k = 0; k < n; k++) {
+        uint8_t x = w[k];
+        size_t i = 0;
+        for (;; i++) {
+            if (i == p.size()) {
+                p.emplace_back();
+                q.emplace_back();
+            }
+            auto it = std::upper_bound(p[i].begin(), p[i].end(), x);
+            if (it == p[i].end()) {
+                p[i].push_back(x);
+                break;
+            }
+            std::swap(x, *it);
+        }
+        q[i].push_back(k);
+    }
+    return {p, q};
+}
+
+bool agrees(Tableau16 const &t, std::vector<std::vector<uint8_t>> const &rows) {
+    for (size_t i = 0; i < 16; i++)
+        for (size_t j = 0; j < 16; j++) {
+            bool in = i < rows.size() && j < rows[i].size();
+            if (t(i, j) != (in ? rows[i][j] : 0xFF))
+                return false;
+        }
+    return true;
+}
+
+// Longest weakly increasing subsequence
+size_t lis_ref(epu8 w, size_t n) {
+    std::vector<size_t> len(n, 1);
+    size_t res = 0;
+    for (size_t i = 0; i < n; i++) {
+        for (size_t j = 0; j < i; j++)
+            if (w[j] <= w[i])
+                len[i] = std::max(len[i], len[j] + 1);
+        res = std::max(res, len[i]);
+    }
+    return res;
+}
+
+std::vector<epu8> sample_words() {
+    std::vector<epu8> res;
+    for (size_t i = 0; i < 200; i++)
+        res.push_back(Perm16::random());
+    for (size_t i = 0; i < 200; i++)
+        res.push_back(random_epu8(1 + i % 16));
+    res.push_back(Epu8.id());
+    res.push_back(Epu8.rev());
+    res.push_back(epu8{});
+    return res;
+}
+
+}  // namespace
+
+TEST_CASE("Tableau16::insert", "[Tableau16][000]") {
+    Tableau16 t;
+    CHECK(t.size() == 0);
+    CHECK(t.validate());
+    for (uint8_t x : {3, 1, 4, 1, 5})
+        t.insert(x);
+    CHECK(t.validate());
+    CHECK(t.shape() == Partition16({3, 2}));
+    CHECK(equal(t.row(0), Epu8({1, 1, 5}, 0xFF)));
+    CHECK(equal(t.row(1), Epu8({3, 4}, 0xFF)));
+    CHECK(equal(t.row(2), Epu8(0xFF)));
+}
+
+TEST_CASE("rsk", "[Tableau16][001]") {
+    for (auto w : sample_words()) {
+        for (size_t n : {0, 5, 16}) {
+            auto pq = rsk(w, n);
+            auto ref = rsk_ref(w, n);
+            CHECK(pq.first.validate());
+            CHECK(pq.second.validate());
+            CHECK(agrees(pq.first, ref.first));
+            CHECK(agrees(pq.second, ref.second));
+            CHECK(pq.first.shape() == pq.second.shape());
+            CHECK(pq.first.size() == n);
+            CHECK(rsk_shape(w, n) == pq.first.shape());
+            CHECK(longest_increasing_subsequence(w, n) == lis_ref(w, n));
+        }
+    }
+}
+
+TEST_CASE("rsk::inverse", "[Tableau16][002]") {
+    for (size_t i = 0; i < 200; i++) {
+        Perm16 p = Perm16::random();
+        auto pq = rsk(p);
+        auto qp = rsk(p.inverse());
+        CHECK(qp.first == pq.second);
+        CHECK(qp.second == pq.first);
+        // Greene: the number of rows is the longest decreasing subsequence
+        CHECK(pq.first.shape().length() ==
+              longest_increasing_subsequence(Epu8(15) - p.v));
+        CHECK(pq.first.shape()[0] == longest_increasing_subsequence(p));
+    }
+}
+
+TEST_CASE("rsk_shapes", "[Tableau16][003]") {
+    std::vector<Perm16> perms;
+    for (size_t i = 0; i < 101; i++)
+        perms.push_back(Perm16::random());
+    for (size_t n : {0, 1, 2, 100, 101}) {
+        std::vector<Partition16> out(n);
+        rsk_shapes(perms.data(), n, out.data());
+        for (size_t i = 0; i < n; i++)
+            CHECK(out[i] == rsk_shape(perms[i]));
+    }
+}
+
+}  // namespace HPCombi
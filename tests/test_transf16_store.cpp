@@ -0,0 +1,100 @@
+//****************************************************************************//
+//    Copyright (C) 2018-2024 Finn Smith <fls3@st-andrews.ac.uk>              //
+//    Copyright (C) 2018-2024 James Mitchell <jdm3@st-andrews.ac.uk>          //
+//    Copyright (C) 2018-2024 Florent Hivert <Florent.Hivert@lisn.fr>,        //
+//                                                                            //
+//  This file is part of HP-Combi <https://github.com/libsemigroups/HPCombi>  //
+//                                                                            //
+//  HP-Combi is free software: you can redistribute it and/or modify it       //
+//  under the terms of the GNU General Public License as published by the     //
+//  Free Software Foundation, either version 3 of the License, or             //
+//  (at your option) any later version.                                       //
+//                                                                            //
+//  HP-Combi is distributed in the hope that it will be useful, but WITHOUT   //
+//  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or     //
+//  FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License      //
+//  for  more details.                                                        //
+//                                                                            //
+//  You should have received a copy of the GNU General Public License along   //
+//  with HP-Combi. If not, see <https://www.gnu.org/licenses/>.               //
+//****************************************************************************//
+
+#include <algorithm>      // for sort
+#include <cstddef>        // for size_t
+#include <cstdint>        // for uint64_t, uint32_t
+#include <unordered_set>  // for unordered_set
+#include <vector>         // for vector
+
+#include "test_main.hpp"                 // for TEST_AGREES
+#include <catch2/catch_test_macros.hpp>  // for operator""_catch_sr, operator==
+
+#include "hpcombi/perm16.hpp"          // for Transf16
+#include "hpcombi/transf16_store.hpp"  // for Transf16Store
+
+namespace HPCombi {
+
+TEST_CASE("Transf16Store::insert", "[Transf16Store][000]") {
+    Transf16Store store;
+    std::unordered_set<Transf16> ref;
+    CHECK(store.size() == 0);
+    CHECK(!store.contains(Transf16::one()));
+    CHECK(store.of_image(0xFFFF).empty());
+    for (size_t i = 0; i < 3000; i++) {
+        Transf16 t = Transf16::random(1 + i % 7);
+        CHECK(store.insert(t) == ref.insert(t).second);
+        CHECK(store.contains(t));
+    }
+    CHECK(store.size() == ref.size());
+    for (size_t i = 0; i < 1000; i++) {
+        Transf16 t = Transf16::random(6);
+        CHECK(store.contains(t) == (ref.count(t) == 1));
+    }
+    size_t total = 0;
+    for (size_t rank = 0; rank <= 16; rank++) {
+        auto elems = store.elements_of_rank(rank);
+        CHECK(elems.size() == store.size_of_rank(rank));
+        total += elems.size();
+        for (auto t : elems) {
+            CHECK(t.rank() == rank);
+            CHECK(ref.count(t) == 1);
+        }
+        for (uint32_t image : store.images_of_rank(rank)) {
+            CHECK(!store.of_image(image).empty());
+            for (uint64_t x : store.of_image(image))
+                CHECK(Transf16(x).image_bitset() == image);
+        }
+    }
+    CHECK(total == store.size());
+}
+
+TEST_CASE("Transf16Store::generated", "[Transf16Store][001]") {
+    // The full transformation monoid on 5 points
+    auto full = Transf16Store::generated({Transf16({1, 0, 2, 3, 4}),
+                                          Transf16({1, 2, 3, 4, 0}),
+                                          Transf16({0, 0, 2, 3, 4})});
+    CHECK(full.size() == 3125);
+    // The points 5 to 15 are fixed
+    std::vector<size_t> expected{0, 5, 300, 1500, 1200, 120};
+    for (size_t k = 1; k <= 5; k++)
+        CHECK(full.size_of_rank(11 + k) == expected[k]);
+    CHECK(full.images_of_rank(13).size() == 10);
+
+    std::vector<Transf16> gens{Transf16({1, 7, 2, 6, 0, 4, 1, 5}),
+                               Transf16({2, 4, 6, 1, 4, 5, 2, 7}),
+                               Transf16({3, 0, 7, 2, 4, 6, 2, 4})};
+    std::unordered_set<Transf16> ref{Transf16::one()};
+    std::vector<Transf16> todo{Transf16::one()};
+    while (!todo.empty()) {
+        Transf16 v = todo.back();
+        todo.pop_back();
+        for (auto g : gens)
+            if (ref.insert(v * g).second)
+                todo.push_back(v * g);
+    }
+    auto store = Transf16Store::generated(gens);
+    CHECK(store.size() == ref.size());
+    for (auto t : ref)
+        CHECK(store.contains(t));
+}
+
+}  // namespace HPCombi
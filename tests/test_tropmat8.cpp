@@ -0,0 +1,125 @@
+//****************************************************************************//
+//     Copyright (C) 2016-2024 Florent Hivert <Florent.Hivert@lisn.fr>,       //
+//                                                                            //
+//  This file is part of HP-Combi <https://github.com/libsemigroups/HPCombi>  //
+//                                                                            //
+//  HP-Combi is free software: you can redistribute it and/or modify it       //
+//  under the terms of the GNU General Public License as published by the     //
+//  Free Software Foundation, either version 3 of the License, or             //
+//  (at your option) any later version.                                       //
+//                                                                            //
+//  HP-Combi is distributed in the hope that it will be useful, but WITHOUT   //
+//  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or     //
+//  FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License      //
+//  for  more details.                                                        //
+//                                                                            //
+//  You should have received a copy of the GNU General Public License along   //
+//  with HP-Combi. If not, see <https://www.gnu.org/licenses/>.               //
+//****************************************************************************//
+
+#include <cstddef>        // for size_t
+#include <cstdint>        // for uint8_t
+#include <sstream>        // for ostringstream
+#include <type_traits>    // for is_trivial
+#include <unordered_set>  // for unordered_set
+#include <vector>         // for vector
+
+#include "test_main.hpp"                 // for Equals
+#include <catch2/catch_test_macros.hpp>  // for operator""_catch_sr, operator==
+
+#include "hpcombi/tropmat8.hpp"  // for TropMat8, MaxPlusMat8, MinPlusMat8
+
+namespace HPCombi {
+
+static_assert(std::is_trivial<MaxPlusMat8<5>>(),
+              "TropMat8 is not a trivial class!");
+
+struct TropMat8Fixture {
+    const uint8_t inf = 0xFF;
+    const MaxPlusMat8<5> mx{{{0, 1, inf}, {2, inf, 3}, {inf, 4, 5}}};
+    const MinPlusMat8<5> mn{{{0, 1, inf}, {2, inf, 3}, {inf, 4, 5}}};
+};
+
+TEST_CASE_METHOD(TropMat8Fixture, "TropMat8::constructors", "[TropMat8][000]") {
+    CHECK(mx(0, 1) == 1);
+    CHECK(mx(1, 2) == 3);
+    CHECK(mx(0, 2) == inf);
+    CHECK(mx(3, 3) == inf);
+    CHECK(mx(7, 0) == inf);
+    auto m = mx;
+    m.set(7, 7, 2);
+    CHECK(m(7, 7) == 2);
+    CHECK(m != mx);
+    CHECK(m < mx);
+    CHECK(MaxPlusMat8<5>::one(2) == MaxPlusMat8<5>({{0, inf}, {inf, 0}}));
+    CHECK(MaxPlusMat8<5>::zero() ==
+          MaxPlusMat8<5>(std::vector<std::vector<uint8_t>>{}));
+    std::ostringstream out;
+    out << MinPlusMat8<5>({{0, 1}, {inf, 5}});
+    CHECK(out.str().substr(0, 34) == " 0 1 * * * * * *\n * 5 * * * * * *\n");
+}
+
+TEST_CASE_METHOD(TropMat8Fixture, "TropMat8::products", "[TropMat8][001]") {
+    // [[0, 1, -], [2, -, 3], [-, 4, 5]]^2 truncated at 5 in max-plus
+    CHECK(mx * mx == MaxPlusMat8<5>({{3, 1, 4}, {2, 5, 5}, {5, 5, 5}}));
+    // and in min-plus
+    CHECK(mn * mn == MinPlusMat8<5>({{0, 1, 4}, {2, 3, 5}, {5, 5, 5}}));
+    CHECK(mx * MaxPlusMat8<5>::one() == mx);
+    CHECK(MinPlusMat8<5>::one() * mn == mn);
+    CHECK(mx * MaxPlusMat8<5>::zero() == MaxPlusMat8<5>::zero());
+}
+
+template <class Mat> void check_products(size_t dim) {
+    std::vector<Mat> sample;
+    for (size_t i = 0; i < 50; i++)
+        sample.push_back(Mat::random(dim));
+    for (auto const &a : sample) {
+        CHECK(a * Mat::one() == a);
+        CHECK(Mat::one() * a == a);
+        CHECK(a.transpose().transpose() == a);
+        for (auto const &b : sample) {
+            CHECK(a * b == a.mult_ref(b));
+            CHECK((a * b).transpose() == b.transpose() * a.transpose());
+        }
+    }
+    for (size_t i = 0; i + 2 < sample.size(); i++) {
+        auto const &a = sample[i], &b = sample[i + 1], &c = sample[i + 2];
+        CHECK((a * b) * c == a * (b * c));
+        CHECK(pow<3>(a) == a * a * a);
+    }
+}
+
+TEST_CASE("TropMat8::mult_ref", "[TropMat8][002]") {
+    for (size_t dim : {1, 3, 8}) {
+        check_products<MaxPlusMat8<5>>(dim);
+        check_products<MinPlusMat8<5>>(dim);
+        check_products<MaxPlusMat8<1>>(dim);
+        check_products<MinPlusMat8<1>>(dim);
+        check_products<MaxPlusMat8<127>>(dim);
+        check_products<MinPlusMat8<127>>(dim);
+    }
+}
+
+TEST_CASE("TropMat8::hash", "[TropMat8][003]") {
+    // The monoid generated by two matrices, enumerated with a hash set
+    std::vector<MinPlusMat8<3>> todo{MinPlusMat8<3>::one(3)};
+    std::unordered_set<MinPlusMat8<3>> elems(todo.begin(), todo.end());
+    std::vector<MinPlusMat8<3>> gens{
+        MinPlusMat8<3>({{1, 0, 0xFF}, {0xFF, 2, 0}, {0, 0xFF, 0xFF}}),
+        MinPlusMat8<3>({{0xFF, 0, 0xFF}, {0xFF, 0xFF, 0}, {0, 0xFF, 0xFF}})};
+    while (!todo.empty()) {
+        auto x = todo.back();
+        todo.pop_back();
+        for (auto const &g : gens)
+            if (elems.insert(x * g).second)
+                todo.push_back(x * g);
+    }
+    CHECK(elems.size() > 10);
+    for (auto const &x : elems) {
+        CHECK(std::hash<MinPlusMat8<3>>{}(x) ==
+              std::hash<MinPlusMat8<3>>{}(MinPlusMat8<3>(x.rows())));
+        CHECK(elems.count(x.mult_ref(MinPlusMat8<3>::one())) == 1);
+    }
+}
+
+}  // namespace HPCombi